@@ -0,0 +1,181 @@
+#ifndef FRANKENSTEIN_S_LIST_FRANKENSTEINFINGERPRINT_H
+#define FRANKENSTEIN_S_LIST_FRANKENSTEINFINGERPRINT_H
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+// Content fingerprints of a list. The sequence hashes are polynomials over the values in
+// insertion order modulo the Mersenne prime 2^61 - 1, one read from the head and one from
+// the tail, so appending, prepending, popping and reversing each take a few multiplications.
+// The multiset hash is a plain sum of mixed value hashes and ignores the order.
+namespace frankenstein_fingerprint {
+    constexpr std::uint64_t modulus = (std::uint64_t(1) << 61) - 1;
+    constexpr std::uint64_t base = 0x1f3d5b79a2c4e687 % modulus;// Fixed, fingerprints of equal lists must match
+
+    inline std::uint64_t add(std::uint64_t a, std::uint64_t b) {
+        std::uint64_t sum = a + b;
+        return sum >= modulus ? sum - modulus : sum;
+    }
+
+    inline std::uint64_t sub(std::uint64_t a, std::uint64_t b) {
+        return a >= b ? a - b : a + modulus - b;
+    }
+
+    // Product of two residues: the 122-bit product is folded once, since 2^61 is 1 modulo the prime
+    constexpr std::uint64_t mul(std::uint64_t a, std::uint64_t b) {
+#if defined(__GNUC__) || defined(__clang__)
+        __extension__ typedef unsigned __int128 wide;
+        wide product = static_cast<wide>(a) * b;
+        std::uint64_t low = static_cast<std::uint64_t>(product);
+        std::uint64_t high = static_cast<std::uint64_t>(product >> 64);
+#else
+        // Four 32x32-bit partial products
+        std::uint64_t a0 = a & 0xffffffffu, a1 = a >> 32;
+        std::uint64_t b0 = b & 0xffffffffu, b1 = b >> 32;
+        std::uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+        std::uint64_t middle = (p00 >> 32) + (p01 & 0xffffffffu) + (p10 & 0xffffffffu);
+        std::uint64_t low = (middle << 32) | (p00 & 0xffffffffu);
+        std::uint64_t high = p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+#endif
+        std::uint64_t folded = (low & modulus) + ((high << 3) | (low >> 61));
+        return folded >= modulus ? folded - modulus : folded;
+    }
+
+    constexpr std::uint64_t power(std::uint64_t a, std::uint64_t e) {
+        std::uint64_t result = 1;
+        while(e) {
+            if(e & 1) result = mul(result, a);
+            a = mul(a, a);
+            e >>= 1;
+        }
+        return result;
+    }
+
+    constexpr std::uint64_t inverse = power(base, modulus - 2);// base^-1, Fermat's little theorem
+
+    // SplitMix64 finalizer, spreads std::hash results that are the identity for integers
+    inline std::uint64_t mix(std::uint64_t x) {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111eb;
+        return x ^ (x >> 31);
+    }
+
+    // Term of a value in the sequence hashes, below the modulus
+    template<typename T>
+    std::uint64_t sequenceTerm(const T &val) {
+        return mix(std::hash<T>{}(val)) % modulus;
+    }
+
+    // Term of a value in the multiset hash
+    template<typename T>
+    std::uint64_t multisetTerm(const T &val) {
+        return mix(std::hash<T>{}(val) ^ 0x9e3779b97f4a7c15);
+    }
+
+    // The values before position p: sums of h_i * base^i and of h_i * base^-i over i < p
+    struct Prefix {
+        std::uint64_t up = 0;
+        std::uint64_t down = 0;
+        std::uint64_t upScale = 1;// base^p
+        std::uint64_t downScale = 1;// base^-p
+
+        template<typename T>
+        void extend(const T &val) {
+            std::uint64_t h = sequenceTerm(val);
+            up = add(up, mul(h, upScale));
+            down = add(down, mul(h, downScale));
+            upScale = mul(upScale, base);
+            downScale = mul(downScale, inverse);
+        }
+    };
+
+    // Hashes of a sequence of n values h_0 .. h_n-1
+    struct Fingerprint {
+        std::uint64_t forward = 0;// Sum of h_i * base^i
+        std::uint64_t backward = 0;// Sum of h_i * base^(n-1-i), the forward hash of the reversed sequence
+        std::uint64_t scale = 1;// base^n
+        std::uint64_t elements = 0;// Sum of the multiset terms, modulo 2^64
+        bool stale = false;// Values changed in a way not tracked, recompute before use
+
+        template<typename T>
+        void append(const T &val) {
+            std::uint64_t h = sequenceTerm(val);
+            forward = add(forward, mul(h, scale));
+            backward = add(mul(backward, base), h);
+            scale = mul(scale, base);
+            elements += multisetTerm(val);
+        }
+
+        template<typename T>
+        void prepend(const T &val) {
+            std::uint64_t h = sequenceTerm(val);
+            forward = add(mul(forward, base), h);
+            backward = add(backward, mul(h, scale));
+            scale = mul(scale, base);
+            elements += multisetTerm(val);
+        }
+
+        template<typename T>
+        void dropFront(const T &val) {
+            std::uint64_t h = sequenceTerm(val);
+            forward = mul(sub(forward, h), inverse);
+            scale = mul(scale, inverse);
+            backward = sub(backward, mul(h, scale));
+            elements -= multisetTerm(val);
+        }
+
+        template<typename T>
+        void dropBack(const T &val) {
+            std::uint64_t h = sequenceTerm(val);
+            scale = mul(scale, inverse);
+            forward = sub(forward, mul(h, scale));
+            backward = mul(sub(backward, h), inverse);
+            elements -= multisetTerm(val);
+        }
+
+        // Insert a value at the position a prefix ends
+        template<typename T>
+        void insert(const T &val, const Prefix &prefix);
+
+        // Remove the value at the position a prefix ends
+        template<typename T>
+        void erase(const T &val, const Prefix &prefix);
+
+        void reverse() {
+            std::swap(forward, backward);
+        }
+
+        void reset() {
+            *this = Fingerprint();
+        }
+    };
+
+    template<typename T>
+    void Fingerprint::insert(const T &val, const Prefix &prefix) {
+        std::uint64_t h = sequenceTerm(val);
+        std::uint64_t before = mul(mul(scale, inverse), prefix.down);// The prefix's share of backward
+        forward = add(add(prefix.up, mul(h, prefix.upScale)), mul(sub(forward, prefix.up), base));
+        backward = add(add(mul(before, base), mul(h, mul(scale, prefix.downScale))), sub(backward, before));
+        scale = mul(scale, base);
+        elements += multisetTerm(val);
+    }
+
+    template<typename T>
+    void Fingerprint::erase(const T &val, const Prefix &prefix) {
+        std::uint64_t h = sequenceTerm(val);
+        std::uint64_t top = mul(scale, inverse);// base^(n-1)
+        std::uint64_t before = mul(top, prefix.down);
+        forward = add(prefix.up, mul(sub(sub(forward, prefix.up), mul(h, prefix.upScale)), inverse));
+        backward = add(mul(before, inverse), sub(sub(backward, before), mul(h, mul(top, prefix.downScale))));
+        scale = top;
+        elements -= multisetTerm(val);
+    }
+
+    // Stand-in member of lists that keep no fingerprint
+    struct Untracked {
+    };
+}
+
+#endif //FRANKENSTEIN_S_LIST_FRANKENSTEINFINGERPRINT_H
@@ -0,0 +1,35 @@
+#ifndef FRANKENSTEIN_S_LIST_FRANKENSTEININDEX_H
+#define FRANKENSTEIN_S_LIST_FRANKENSTEININDEX_H
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+
+// Hash index of the lists with HashIndex in their policy: every distinct value maps to the
+// group of nodes holding it. The nodes of a group are chained to each other through their
+// equal_prev/equal_next links in insertion order, so a group is found with one hash lookup
+// and walked without visiting any other node.
+namespace frankenstein_index {
+    template<typename Link>
+    struct Group {
+        Link first;// First node of the value in insertion order
+        Link last;// Last node of the value in insertion order
+        std::size_t count;// Nodes holding the value
+    };
+
+    template<typename T, typename Link>
+    using Table = std::unordered_map<T, Group<Link>, std::hash<T>>;
+
+    // Heap bytes of a table: the bucket array plus one allocation per distinct value holding the
+    // key, the group, the chaining link and a cached hash. An estimate, the layout is the library's.
+    template<typename T, typename Link>
+    std::size_t tableBytes(const Table<T, Link> &table) noexcept {
+        using Entry = typename Table<T, Link>::value_type;
+        return table.bucket_count() * sizeof(void*) + table.size() * (sizeof(Entry) + sizeof(void*) + sizeof(std::size_t));
+    }
+
+    // Stand-in for the table in lists without an index
+    struct Unindexed {
+    };
+}
+
+#endif //FRANKENSTEIN_S_LIST_FRANKENSTEININDEX_H
@@ -0,0 +1,89 @@
+#ifndef FRANKENSTEIN_S_LIST_FRANKENSTEINJOURNAL_H
+#define FRANKENSTEIN_S_LIST_FRANKENSTEINJOURNAL_H
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+// Mutation journal file formats. A journal is two files: the checkpoint at the given
+// path (header, then a list snapshot) and the log next to it (header, then records).
+// Both headers carry a generation; a log belongs to the checkpoint of its generation.
+namespace frankenstein_journal {
+    constexpr char checkpointMagic[8] = {'F', 'R', 'K', 'L', 'C', 'K', 'P', '\0'};
+    constexpr char logMagic[8] = {'F', 'R', 'K', 'L', 'L', 'O', 'G', '\0'};
+    constexpr std::uint32_t version = 1;
+    constexpr std::uint32_t byteOrder = 0x01020304;
+
+    // Record tags, each followed by the arguments of the member it stands for:
+    // values as in snapshots, positions and counts as 64-bit integers, lists as snapshots
+    enum class Op : std::uint8_t {
+        push_back = 1,// value
+        push_front,// value
+        insertAt,// value, position
+        pop_front,
+        pop_back,
+        erase,// position
+        eraseRange,// position, count
+        remove,// value
+        unique,
+        reverse,
+        sort,
+        resize,// count
+        emplace_front,// count
+        splice,// position, list
+        assign,// value, count
+        merge,// list
+        clear,
+        replace,// list, becomes the whole contents
+        setUnion,// list
+        setIntersection,// list
+        setDifference,// list
+        setSymmetricDifference// list
+    };
+
+    // Header of both files
+    struct Header {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t byteOrder;
+        std::uint64_t generation;// Bumped by every checkpoint
+    };
+
+    // Write a file header
+    inline void writeHeader(std::ostream &os, const char (&magic)[8], std::uint64_t generation) {
+        Header header{};
+        std::copy(magic, magic + 8, header.magic);
+        header.version = version;
+        header.byteOrder = byteOrder;
+        header.generation = generation;
+        os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+
+    // Read and check a file header, returning its generation
+    inline std::uint64_t readHeader(std::istream &is, const char (&magic)[8]) {
+        Header header;
+        if(!is.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+            throw std::runtime_error("Truncated list journal header.");
+        }
+        if(!std::equal(magic, magic + 8, header.magic) || header.version != version || header.byteOrder != byteOrder) {
+            throw std::runtime_error("Not a list journal or unsupported version.");
+        }
+        return header.generation;
+    }
+
+    // Journal attached to a list: the open log and where the checkpoint goes
+    struct Journal {
+        std::string path;// Checkpoint file, the log is path + ".log"
+        std::ofstream log;// Records are buffered here until flushed
+        std::uint64_t generation = 0;// Generation of the current checkpoint
+        unsigned depth = 0;// Mutating members in progress, only the outermost one is recorded
+
+        std::string logPath() const {// Path of the log file
+            return path + ".log";
+        }
+    };
+}
+
+#endif //FRANKENSTEIN_S_LIST_FRANKENSTEINJOURNAL_H
@@ -0,0 +1,46 @@
+#ifndef FRANKENSTEIN_S_LIST_FRANKENSTEINKEYPREFIX_H
+#define FRANKENSTEIN_S_LIST_FRANKENSTEINKEYPREFIX_H
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Normalized key prefix of the lists with CachedKeyPrefix in their policy. Each node caches
+// an unsigned integer next to its links that orders like the value whenever two prefixes
+// differ, so most comparisons are one integer compare and the values are only compared on a
+// tie. Specialize it for other types with expensive comparisons as
+//     template<> struct FrankensteinKeyPrefix<MyType> {
+//         static std::uint64_t of(const MyType&) noexcept;// equal values give equal prefixes, of(a) < of(b) only if a < b
+//     };
+template<typename T, typename = void>
+struct FrankensteinKeyPrefix;
+
+namespace frankenstein_prefix {
+    // The first eight bytes big-endian, a shorter string padded with zero bytes. Padding only
+    // makes a string tie with its extensions by zero bytes, which the full compare settles.
+    inline std::uint64_t pack(const char *data, std::size_t size) noexcept {
+        std::uint64_t prefix = 0;
+        std::size_t n = (size < 8) ? size : 8;
+        for(std::size_t i = 0; i < n; ++i) {
+            prefix |= std::uint64_t(static_cast<unsigned char>(data[i])) << (56 - 8 * i);
+        }
+        return prefix;
+    }
+}
+
+// Strings of char, which compare their characters as unsigned bytes
+template<typename Alloc>
+struct FrankensteinKeyPrefix<std::basic_string<char, std::char_traits<char>, Alloc>> {
+    static std::uint64_t of(const std::basic_string<char, std::char_traits<char>, Alloc> &str) noexcept {
+        return frankenstein_prefix::pack(str.data(), str.size());
+    }
+};
+
+template<>
+struct FrankensteinKeyPrefix<std::string_view> {
+    static std::uint64_t of(std::string_view str) noexcept {
+        return frankenstein_prefix::pack(str.data(), str.size());
+    }
+};
+
+#endif //FRANKENSTEIN_S_LIST_FRANKENSTEINKEYPREFIX_H
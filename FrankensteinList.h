@@ -1,28 +1,133 @@
 #ifndef FRANKENSTEIN_S_LIST_FRANKENSTEINLIST_H
 #define FRANKENSTEIN_S_LIST_FRANKENSTEINLIST_H
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <string_view>
+#include <thread>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
 #include "Node.h"
+#include "FrankensteinSerializer.h"
+#include "FrankensteinJournal.h"
+#include "FrankensteinText.h"
+#include "FrankensteinFingerprint.h"
+#include "FrankensteinStats.h"
+#include "FrankensteinTiming.h"
+#include "FrankensteinMemory.h"
+#include "FrankensteinRuns.h"
+#include "FrankensteinIndex.h"
 
-template<typename T>
+template<typename T, typename ChainSet>
+class MappedFrankensteinList;
+
+template<typename T, typename Policy>
+class RecordingFrankensteinList;
+
+//k-way merge of the sorted chains of many lists into a new ascending list, on the given number of threads or by size
+template<typename Range>
+auto merge_all(const Range&, unsigned = 0);
+
+template<typename T, typename Policy = DefaultListPolicy>
 class FrankensteinList {
+    template<typename U, typename C>
+    friend class MappedFrankensteinList;// Persists the list heads in its file
+    template<typename U, typename P>
+    friend class RecordingFrankensteinList;// Writes and reads trace values as snapshots store them
+public:
+    using NodeType = Node<T, Policy>;
+    using link_type = typename NodeType::link_type;// Node* for PointerLinks, a slot index for IndexLinks
+    using Storage = typename Policy::Links::template Storage<NodeType>;
+    using Chains = typename Policy::Chains;
 private:
-    void PutInSortedOrder(Node<T>*);// Helper function for sorting the list
+    static constexpr link_type null = NodeType::null;
+    static constexpr bool pointer_links = std::is_pointer<link_type>::value;
+    static constexpr unsigned hint_distance = Policy::Hints::distance;
+    static constexpr bool fingerprinted = Policy::Fingerprint::enabled;
+    static constexpr bool counting = Policy::Stats::enabled;
+    static constexpr bool grouped = Policy::Runs::enabled;
+    static constexpr bool indexed = Policy::Index::enabled;
+    static constexpr bool prefixed = Policy::KeyPrefix::enabled;
+    using JournalOp = frankenstein_journal::Op;
+    using Timer = frankenstein_timing::Scope<Policy::Timing::enabled>;// Times a public call with OperationTiming in the policy, empty otherwise
+    using TimedOp = frankenstein_timing::Operation;
+
+    // Parts of a set operation's result: values without a partner in the other list, and matched pairs
+    enum SetPart : unsigned {onlyFirst = 1, onlySecond = 2, inBoth = 4};
+
+    // A value with its cached key prefix, always 0 in lists without prefixes
+    struct Key {
+        const T& val;
+        std::uint64_t prefix;
+    };
+
+    NodeType* at(link_type) const;// Resolve a link through the node storage
+    void tally(std::uint64_t ListStats::*, std::uint64_t = 1) const noexcept;// Add to a work counter of a counting list, nothing otherwise
+    static Key keyOf(const NodeType*) noexcept;// Key of a node, with the prefix cached in it
+    static Key keyOf(const T&);// Key of a value, computing its prefix
+    static bool less(const Key&, const Key&);// Order two keys by their prefixes, by the values on a tie
+    static bool equal(const Key&, const Key&);// Compare two keys for equality, unequal prefixes settle it
+    template<typename... Args>
+    link_type createNode(Args&&...);// Create a node in the storage, counting the allocation
+    void freeNode(link_type) noexcept;// Destroy a node in the storage, counting the free
+    void indexAppend(link_type);// Enter a new node into the hash index behind the nodes of equal value
+    void indexMove(link_type, link_type) noexcept;// Move a node of the hash index behind another node of equal value, to the front for null
+    void indexErase(link_type) noexcept;// Take a node out of the hash index
+    void reindexOrder() noexcept;// Rechain every group of the hash index in insertion order after the insertion chain was reordered
+    link_type linkAt(std::size_t) const;// Get the link of the node at a specified position
+    link_type linkAt(std::size_t, frankenstein_fingerprint::Prefix&) const;// The same, adding every value up to that node to a fingerprint prefix
+    link_type insertionPrev(link_type) const;// Get the insertion predecessor, walking from head without prev links
+    link_type sortedPrev(link_type) const;// Get the ascending predecessor, walking from asc_head without lesser links
+    link_type sortedLast() const;// Get the largest node, walking the ascending chain without lesser links
+    void unlinkInsertion(link_type, link_type) noexcept;// Detach a node from the insertion chain given its predecessor
+    void unlinkSorted(link_type, link_type) noexcept;// Detach a node from the sorted chain given its predecessor
+    void destroyNode(link_type) noexcept;// Detach a node from both chains and free it
+    void destroyNodes(std::vector<link_type>&, bool = true);// Detach a batch of nodes from both chains and free them, from the insertion chain only when the flag is false
+    std::uint32_t findRun(const T&) const;// Get the run of a value, stepping from run to run; none when the value is absent
+    void destroyRun(std::uint32_t);// Detach a whole run from the sorted chain in one step, then free its nodes
+    void rebuildRuns() noexcept(!grouped);// Group the sorted chain into runs anew after it was relinked in bulk
+    void PutInSortedOrder(link_type);// Helper function for sorting the list
+    void appendUnsorted(link_type) noexcept;// Append a node to the insertion chain only
+    void linkSortedChain(const std::vector<link_type>&) noexcept(!grouped);// Rebuild the sorted chain from nodes given in ascending order
+    void linkSortedAlongInsertion() noexcept(!grouped);// Make the sorted chain follow the insertion chain, whose values ascend
+    void copyChains(const FrankensteinList&);// Fill an empty list with copies of another list's nodes, linking both chains as they are there
+    void abortCompaction() noexcept;// Stop an incremental compaction, nodes already moved stay where they are
     void clear() noexcept;// Helper function for clearing the list
+    template<typename Visit>
+    static void pairSorted(const FrankensteinList&, const FrankensteinList&, Visit&&);// Walk two sorted chains in lockstep: Visit(first, second) per matched pair, one link null for a value without a partner
+    static FrankensteinList combine(const FrankensteinList&, const FrankensteinList&, unsigned);// New list of the SetPart parts of two lists, in ascending order
+    void combineWith(FrankensteinList&, unsigned, JournalOp);// Keep the SetPart parts, moving values in from the other list and leaving it empty
+    static FrankensteinList mergeLists(const std::vector<const FrankensteinList*>&, unsigned);// k-way merge along the sorted chains, 0 threads picks a count by size
+    frankenstein_fingerprint::Fingerprint currentFingerprint() const;// The fingerprint, recomputed when stale or not kept
+    static void writeValue(std::ostream&, const T&);// Write one value as snapshots store it
+    static T readValue(std::istream&);// Read one value as snapshots store it
+    template<typename Value, typename Order>
+    static void readSnapshot(std::istream&, Value&&, Order&&);// Parse a snapshot: Value(T&&) per value in insertion order, then Order(position) in ascending order
+    template<typename Arg>
+    static void journalArg(std::ostream&, const Arg&);// Write a record argument: a value, a position or count, or a list
 public:
 
     // Constructors and destructor
     FrankensteinList();// Default constructor
     FrankensteinList(std::initializer_list<T>);// Constructor with initializer lis
-    FrankensteinList(const FrankensteinList<T>&);// Copy constructor
+    explicit FrankensteinList(std::pmr::memory_resource*);// Constructor allocating the nodes from a memory resource
+    FrankensteinList(const FrankensteinList&);// Copy constructor
     FrankensteinList(FrankensteinList&&) noexcept;// Move constructor
     ~FrankensteinList();// Destructor
 
     // Assignment operators
-    FrankensteinList<T>& operator=(const FrankensteinList<T>&);// Copy assignment operator
-    FrankensteinList<T>& operator=(FrankensteinList<T>&&) noexcept ;// Move assignment operator
+    FrankensteinList& operator=(const FrankensteinList&);// Copy assignment operator
+    FrankensteinList& operator=(FrankensteinList&&) noexcept ;// Move assignment operator
 
     void insertAt(const T&, std::size_t);// Insert an element at a specified position
-    Node<T>* getNodeAt(std::size_t);// Get a pointer to the node at a specified position
+    NodeType* getNodeAt(std::size_t);// Get a pointer to the node at a specified position
     void push_front(const T&);// Insert an element at the front
     void pop_front();// Remove the element from the front
     T& front();// Get a reference to the front element
@@ -32,40 +137,105 @@ public:
     bool empty() const;// Check if the list is empty
     void reverse();// Reverse the order of elements in the list
     void unique();//Removes all unique elements
-    void merge(const FrankensteinList<T>&);// Merge two lists
+    void merge(FrankensteinList&);// Merge two lists, the other list is left empty
     void remove(const T&);// Remove elements with a specific value
     void erase(const T&);// Erase the element at a specific position
     void erase(const T&, std::size_t);// Erase a range of elements starting at a specific position
     void sort();// Sort the list
     void resize(std::size_t);// Resize the list
     void emplace_front(std::size_t);//Adding or removing new elements
-    void splice(std::size_t, const FrankensteinList<T>&);// Insert elements from another list at the specified position.
+    void splice(std::size_t, const FrankensteinList&);// Insert elements from another list at the specified position.
     void assign(std::size_t, const T&);// Assign a specified number of elements with the given value.
-    Node<T>* getHead() const;// Get a pointer to the head of the list
-    void setHead(Node<T>*);// Set the head pointer
-    Node<T>* getTail() const;// Get a pointer to the tail of the list
-    void setTail(Node<T>*);// Set the tail pointer
-    Node<T>* getAscHead() const;// Get a pointer to the ascending head of the list
-    void setAscHead(Node<T>*);// Set the ascending head pointer
-    Node<T>* getDescHead() const;// Get a pointer to the descending head of the list
-    void setDescHead(Node<T>*);// Set the descending head pointer
+    void swap(FrankensteinList&) noexcept;// Exchange the contents of two lists
+    bool contains(const T&) const;// Check whether a value is present
+    std::size_t count(const T&) const;// Count the occurrences of a value
+    NodeType* find_first_inserted(const T&);// Get the first node holding a value in insertion order, null when absent
+
+    // Multiset algebra in O(n + m) along both sorted chains. The list keeps its surviving nodes in insertion order and
+    // appends the values it takes from the other list in ascending order; the other list is left empty.
+    void set_union_with(FrankensteinList&);// Keep every value as often as it occurs in either list
+    void set_intersection_with(FrankensteinList&);// Keep every value as often as it occurs in both lists
+    void set_difference_with(FrankensteinList&);// Drop one occurrence of a value per occurrence in the other list
+    void set_symmetric_difference_with(FrankensteinList&);// Keep the occurrences without a partner in the other list
+    NodeType* resolve(link_type) const;// Follow a next/prev/greater/lesser link of a node
+    std::pmr::memory_resource* getMemoryResource() const;// Get the memory resource the nodes come from
+    NodeType* getHead() const;// Get a pointer to the head of the list
+    void setHead(NodeType*);// Set the head pointer
+    NodeType* getTail() const;// Get a pointer to the tail of the list
+    void setTail(NodeType*);// Set the tail pointer
+    NodeType* getAscHead() const;// Get a pointer to the ascending head of the list
+    void setAscHead(NodeType*);// Set the ascending head pointer
+    NodeType* getDescHead() const;// Get a pointer to the descending head of the list, derived without lesser links
+    void setDescHead(NodeType*);// Set the descending head pointer, ignored without lesser links
     int getSize() const;// Get the current size of the list
     void setSize(int);// Set the size of the list
 
 
+    // Content fingerprints: kept up to date by every mutating member with ContentFingerprint in the policy,
+    // computed by a walk otherwise
+    std::uint64_t sequenceHash() const;// Hash of the values in insertion order
+    std::uint64_t multisetHash() const;// Hash of the values regardless of their order
+    void refreshFingerprint();// Recompute the fingerprint after values were changed in place
+    bool sameElements(const FrankensteinList&) const;// Check whether two lists hold the same values in any order
+
+    // Work counters, kept with CountingStats in the policy. Iterator steps and compaction are not counted,
+    // and a counting list must not be used from several threads even through const members.
+    ListStats stats() const;// Snapshot of the counters since the last reset, all zero without CountingStats
+    void resetStats();// Set the counters to zero
+
+    // Memory accounting from the storage's bookkeeping, cheap enough to call periodically
+    MemoryUsage memory_usage() const;// Bytes of values, links, free slots, allocator slack and overhead
+
+    // Binary snapshots: values in insertion order plus the ascending order as positions,
+    // so loading relinks both chains without comparing values
+    void save(std::ostream&) const;// Write the list in the versioned snapshot format
+    void load(std::istream&);// Replace the contents with a snapshot, unchanged if it is invalid
+
+    // Mutation journal: every mutating member appends a record to a log before it changes the list,
+    // a checkpoint writes a full snapshot and empties the log
+    void startJournal(const std::string&);// Checkpoint the list to a path and log its changes to path.log
+    void checkpoint();// Write a full snapshot and start an empty log
+    void recover(const std::string&);// Replace the contents with a checkpoint plus its log, then keep journaling there
+    void flushJournal();// Write the buffered log records to the file
+    void stopJournal();// Flush the log and detach the journal
+
+    // Bulk text input: whitespace-separated numbers, parsed on a second thread while this one links the nodes
+    static FrankensteinList from_stream(std::istream&, std::pmr::memory_resource* = std::pmr::get_default_resource());// Build a list from a text stream
+    static FrankensteinList from_file(const std::string&, std::pmr::memory_resource* = std::pmr::get_default_resource());// Build a list from a text file
+
     // Printing functions
     void printSortedAscendingOrder() const;// Print the list in ascending order
     void printSortedDescendingOrder() const;// Print the list in descending order
 
+    // Buffered formatting: arithmetic values go through std::to_chars into a per-thread buffer
+    // that is written in large pieces, other values through operator<<
+    enum class PrintOrder{insertion, ascending, descending};
+    void print(std::ostream&, PrintOrder = PrintOrder::insertion, std::string_view = " ") const;// Write the values to a stream with a separator between them
+    template<typename OutputIt>
+    OutputIt format_to(OutputIt, PrintOrder = PrintOrder::insertion, std::string_view = " ") const;// Write the values as characters to an output iterator
+
+    // Set algebra building a new list
+    template<typename U, typename P>
+    friend FrankensteinList<U, P> set_union(const FrankensteinList<U, P>&, const FrankensteinList<U, P>&);
+    template<typename U, typename P>
+    friend FrankensteinList<U, P> set_intersection(const FrankensteinList<U, P>&, const FrankensteinList<U, P>&);
+    template<typename U, typename P>
+    friend FrankensteinList<U, P> set_difference(const FrankensteinList<U, P>&, const FrankensteinList<U, P>&);
+    template<typename U, typename P>
+    friend FrankensteinList<U, P> set_symmetric_difference(const FrankensteinList<U, P>&, const FrankensteinList<U, P>&);
+
+    template<typename Range>
+    friend auto merge_all(const Range&, unsigned);
+
     // Friend function for output stream operator
-    template<typename U>
-    friend std::ostream& operator<<(std::ostream&, const FrankensteinList<U>&);
+    template<typename U, typename P>
+    friend std::ostream& operator<<(std::ostream&, const FrankensteinList<U, P>&);
 
     // Define an iterator class for FrankensteinList
-    enum class IteratorType{head, asc_head};
+    enum class IteratorType : std::uint8_t {head, asc_head};
     class Iterator {
     public:
-        Iterator(Node<T>*, IteratorType = IteratorType::head);// Constructor
+        Iterator(NodeType*, IteratorType = IteratorType::head, const Storage* = nullptr);// Constructor, index links need the list's storage
 
         T& operator*();// Dereference operator, returns a reference to the current element
         T* operator->();// Arrow operator, returns a pointer to the current element
@@ -74,8 +244,9 @@ public:
         bool operator==(const Iterator&);// Equality operator, compares iterators for equality
         bool operator!=(const Iterator&);// Inequality operator, compares iterators for inequality
     private:
-        Node<T> *ptr;// Pointer to the current node
+        NodeType *ptr;// Pointer to the current node
         IteratorType type;// Type of iterator (head or asc_head)
+        const Storage* storage;// Storage resolving the links of the current node
     };
 
     Iterator begin(IteratorType type = IteratorType::head);// Begin iterator function, returns an iterator pointing to the beginning
@@ -84,7 +255,7 @@ public:
     // ConstIterator class for FrankensteinList
     class ConstIterator{
     public:
-        ConstIterator(const Node<T>*, IteratorType type = IteratorType::head);// Constructor
+        ConstIterator(const NodeType*, IteratorType type = IteratorType::head, const Storage* = nullptr);// Constructor, index links need the list's storage
 
         const T& operator*() const;// Const dereference operator, returns a reference to the current element
         const T* operator->() const;// Const arrow operator, returns a pointer to the current element
@@ -93,43 +264,96 @@ public:
         bool operator==(const ConstIterator&) const;// Equality operator, compares const iterators for equality
         bool operator!=(const ConstIterator&) const;// Inequality operator, compares const iterators for inequality
     private:
-        const Node<T>* ptr;// Pointer to the current node
+        const NodeType* ptr;// Pointer to the current node
         IteratorType type;// Type of iterator (head or asc_head)
+        const Storage* storage;// Storage resolving the links of the current node
     };
 
     ConstIterator cbegin(IteratorType type = IteratorType::head) const;// Const begin iterator function, returns a const iterator pointing to the beginning
     ConstIterator cend(IteratorType type = IteratorType::head) const;// Const end iterator function, returns a const iterator pointing to the end
+
+    // Cache-conscious compaction: relocate nodes so that a walk in the given order touches consecutive memory.
+    // Node pointers obtained before a compaction are invalidated.
+    void compact(IteratorType = IteratorType::head);// Move every node into one contiguous block in traversal order
+    bool compactStep(IteratorType = IteratorType::head, std::size_t = 1024);// Move up to the given number of nodes, true once a full pass is done
 private:
-    Node<T>* head;// Pointer to the head of the list
-    Node<T>* tail;// Pointer to the tail of the list
-    Node<T>* asc_head;// access nodes in ascending order
-    Node<T>* desc_head;// access nodes in descending order
+    template<typename Visit>
+    void walk(IteratorType, Visit&&) const;// Walk a chain, prefetching along the jump hints; Visit(link, node) returns false to stop
+    template<typename Visit>
+    void visitValues(PrintOrder, Visit&&) const;// Visit every value in a print order
+    template<typename Flush>
+    void formatValues(PrintOrder, std::string_view, bool, Flush&&) const;// Format the values, Flush(std::string_view) takes each full buffer; the flag adds a trailing separator
+    void streamValues(std::ostream&, PrintOrder) const;// Write every value followed by a space, with the stream's own formatting when it differs from std::to_chars
+
+    // Journal entry of a mutating member: the outermost member writes its record ahead of
+    // the change, the members it delegates to find the journal busy and write nothing
+    class JournalGuard {
+    public:
+        template<typename... Args>
+        JournalGuard(const FrankensteinList&, JournalOp, const Args&...);// Write the record unless a member is already in progress
+        ~JournalGuard();// Leave the member
+        JournalGuard(const JournalGuard&) = delete;
+        JournalGuard& operator=(const JournalGuard&) = delete;
+    private:
+        frankenstein_journal::Journal* journal;// Journal of the list, null when it has none
+    };
+
+    class Replay;// Values and sorted ranks a log is replayed on
+
+    Storage nodes;// Owner of the nodes, resolves links to nodes
+    link_type head;// Link to the head of the list
+    link_type tail;// Link to the tail of the list
+    link_type asc_head;// access nodes in ascending order
+    link_type desc_head;// access nodes in descending order, maintained only with lesser links
     std::size_t size;// Current size of the list
+    bool compacting;// Whether an incremental compaction is in progress
+    mutable std::conditional_t<counting, ListStats, UncountedStats> counters;// Work counters, empty without CountingStats and packed next to the flag
+    mutable std::conditional_t<fingerprinted, frankenstein_fingerprint::Fingerprint, frankenstein_fingerprint::Untracked> fingerprint;// Content hashes, refreshed lazily when stale; empty without fingerprints and packed next to the flag
+    std::conditional_t<grouped, frankenstein_runs::Table<link_type>, frankenstein_runs::Ungrouped> runs;// Equal-key runs of the sorted chain, empty without EqualRuns and packed next to the flag
+    std::conditional_t<indexed, frankenstein_index::Table<T, link_type>, frankenstein_index::Unindexed> hashIndex;// Nodes by value, empty without HashIndex and packed next to the flag
+    IteratorType compactOrder;// Traversal order of the incremental compaction
+    link_type compactCursor;// Next node the incremental compaction moves
+    std::unique_ptr<frankenstein_journal::Journal> journal;// Mutation journal, moves and swaps along with the nodes
 };
 
+// Small list: the first N nodes live inside the list object, so lists that stay
+// that small never allocate. Moving the list relocates the inline nodes.
+template<typename T, std::uint32_t N = 16>
+using SmallFrankensteinList = FrankensteinList<T, SmallListPolicy<N>>;
+
 
 // Comparison operators
-template<typename T>
-bool operator==(const FrankensteinList<T>&, const FrankensteinList<T>&);
-template<typename T>
-bool operator!=(const FrankensteinList<T>&, const FrankensteinList<T>&);
-template<typename T>
-bool operator<(const FrankensteinList<T>&, const FrankensteinList<T>&);
-template<typename T>
-bool operator<=(const FrankensteinList<T>&, const FrankensteinList<T>&);
-template<typename T>
-bool operator>(const FrankensteinList<T>&, const FrankensteinList<T>&);
-template<typename T>
-bool operator>=(const FrankensteinList<T>&, const FrankensteinList<T>&);
+template<typename T, typename P>
+bool operator==(const FrankensteinList<T, P>&, const FrankensteinList<T, P>&);
+template<typename T, typename P>
+bool operator!=(const FrankensteinList<T, P>&, const FrankensteinList<T, P>&);
+template<typename T, typename P>
+bool operator<(const FrankensteinList<T, P>&, const FrankensteinList<T, P>&);
+template<typename T, typename P>
+bool operator<=(const FrankensteinList<T, P>&, const FrankensteinList<T, P>&);
+template<typename T, typename P>
+bool operator>(const FrankensteinList<T, P>&, const FrankensteinList<T, P>&);
+template<typename T, typename P>
+bool operator>=(const FrankensteinList<T, P>&, const FrankensteinList<T, P>&);
 
 
 //swap two lists
-template<typename T>
-void swap(FrankensteinList<T>&, FrankensteinList<T>&);
+template<typename T, typename P>
+void swap(FrankensteinList<T, P>&, FrankensteinList<T, P>&);
 
 //merge two
-template<typename T>
-FrankensteinList<T> mergeTwoList(const FrankensteinList<T>&, const FrankensteinList<T>&);
+template<typename T, typename P>
+FrankensteinList<T, P> merge(const FrankensteinList<T, P>&, const FrankensteinList<T, P>&);
+
+//multiset algebra in O(n + m), the result holds the values in ascending order
+template<typename T, typename P>
+FrankensteinList<T, P> set_union(const FrankensteinList<T, P>&, const FrankensteinList<T, P>&);
+template<typename T, typename P>
+FrankensteinList<T, P> set_intersection(const FrankensteinList<T, P>&, const FrankensteinList<T, P>&);
+template<typename T, typename P>
+FrankensteinList<T, P> set_difference(const FrankensteinList<T, P>&, const FrankensteinList<T, P>&);
+template<typename T, typename P>
+FrankensteinList<T, P> set_symmetric_difference(const FrankensteinList<T, P>&, const FrankensteinList<T, P>&);
 
 #include "FrankensteinList.tpp"
 
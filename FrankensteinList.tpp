@@ -1,98 +1,544 @@
+// Resolve a link through the node storage
+template<typename T, typename Policy>
+typename FrankensteinList<T, Policy>::NodeType* FrankensteinList<T, Policy>::at(link_type link) const {
+    return nodes.get(link);
+}
+
+// Add to a work counter of a counting list, nothing otherwise
+template<typename T, typename Policy>
+inline void FrankensteinList<T, Policy>::tally(std::uint64_t ListStats::*counter, std::uint64_t amount) const noexcept {
+    if constexpr (counting) {
+        counters.*counter += amount;
+    }
+}
+
+// Key of a node, with the prefix cached in it
+template<typename T, typename Policy>
+inline typename FrankensteinList<T, Policy>::Key FrankensteinList<T, Policy>::keyOf(const NodeType *node) noexcept {
+    if constexpr (prefixed) {
+        return Key{node->val, node->prefix};
+    } else {
+        return Key{node->val, 0};
+    }
+}
+
+// Key of a value, computing its prefix
+template<typename T, typename Policy>
+inline typename FrankensteinList<T, Policy>::Key FrankensteinList<T, Policy>::keyOf(const T &val) {
+    if constexpr (prefixed) {
+        return Key{val, FrankensteinKeyPrefix<T>::of(val)};
+    } else {
+        return Key{val, 0};
+    }
+}
+
+// Order two keys: one integer compare unless the prefixes tie
+template<typename T, typename Policy>
+inline bool FrankensteinList<T, Policy>::less(const Key &a, const Key &b) {
+    if constexpr (prefixed) {
+        if(a.prefix != b.prefix) return a.prefix < b.prefix;
+    }
+    return a.val < b.val;
+}
+
+// Compare two keys for equality, equal values always have equal prefixes
+template<typename T, typename Policy>
+inline bool FrankensteinList<T, Policy>::equal(const Key &a, const Key &b) {
+    if constexpr (prefixed) {
+        if(a.prefix != b.prefix) return false;
+    }
+    return a.val == b.val;
+}
+
+// Create a node in the storage, counting the allocation
+template<typename T, typename Policy>
+template<typename... Args>
+typename FrankensteinList<T, Policy>::link_type FrankensteinList<T, Policy>::createNode(Args&&... args) {
+    if constexpr (grouped) {
+        runs.reserve(1);// The sorted insertion that follows cannot fail then
+    }
+    link_type link = nodes.create(std::forward<Args>(args)...);
+    if constexpr (indexed) {
+        try {
+            indexAppend(link);
+        } catch(...) {
+            nodes.destroy(link);
+            throw;
+        }
+    }
+    tally(&ListStats::allocations);
+    return link;
+}
+
+// Destroy a node in the storage, counting the free
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::freeNode(link_type link) noexcept {
+    if constexpr (indexed) {
+        indexErase(link);
+    }
+    nodes.destroy(link);
+    tally(&ListStats::frees);
+}
+
+// Enter a new node into the hash index behind the nodes of equal value. Nodes are created
+// right before they are linked, so creation order is insertion order for appended nodes;
+// the ones put elsewhere are moved to their place in the group afterwards.
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::indexAppend(link_type link) {
+    NodeType* node = at(link);
+    auto [entry, added] = hashIndex.try_emplace(node->val, frankenstein_index::Group<link_type>{link, link, 1});
+    if(added) return;
+    auto& group = entry->second;
+    node->equal_prev = group.last;
+    at(group.last)->equal_next = link;
+    group.last = link;
+    ++group.count;
+}
+
+// Move a node of the hash index behind another node of equal value, or in front of all of them for null
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::indexMove(link_type link, link_type after) noexcept {
+    NodeType* node = at(link);
+    if(node->equal_prev == after) return;
+    auto& group = hashIndex.find(node->val)->second;
+
+    // Detach
+    if(node->equal_prev != null) at(node->equal_prev)->equal_next = node->equal_next; else group.first = node->equal_next;
+    if(node->equal_next != null) at(node->equal_next)->equal_prev = node->equal_prev; else group.last = node->equal_prev;
+
+    // Attach behind 'after'
+    node->equal_prev = after;
+    node->equal_next = (after == null) ? group.first : at(after)->equal_next;
+    if(after != null) at(after)->equal_next = link; else group.first = link;
+    if(node->equal_next != null) at(node->equal_next)->equal_prev = link; else group.last = link;
+}
+
+// Take a node out of the hash index, dropping its value once no node holds it
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::indexErase(link_type link) noexcept {
+    NodeType* node = at(link);
+    auto entry = hashIndex.find(node->val);
+    auto& group = entry->second;
+    if(--group.count == 0) {
+        hashIndex.erase(entry);
+        return;
+    }
+    if(node->equal_prev != null) at(node->equal_prev)->equal_next = node->equal_next; else group.first = node->equal_next;
+    if(node->equal_next != null) at(node->equal_next)->equal_prev = node->equal_prev; else group.last = node->equal_prev;
+}
+
+// Rechain every group of the hash index along the insertion chain, one lookup per node
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::reindexOrder() noexcept {
+    for(auto& entry : hashIndex) {
+        entry.second.first = null;
+        entry.second.last = null;
+    }
+    for(link_type curr = head; curr != null; curr = at(curr)->next) {
+        NodeType* node = at(curr);
+        auto& group = hashIndex.find(node->val)->second;
+        node->equal_prev = group.last;
+        node->equal_next = null;
+        if(group.last != null) at(group.last)->equal_next = curr; else group.first = curr;
+        group.last = curr;
+    }
+}
+
+// Get the link of the node at a specified position
+template<typename T, typename Policy>
+typename FrankensteinList<T, Policy>::link_type FrankensteinList<T, Policy>::linkAt(std::size_t pos) const {
+    if(pos >= size) {
+        throw std::out_of_range("Position is out of range.");
+    }
+
+    link_type found = null;
+    std::size_t count = 0;
+    walk(IteratorType::head, [&](link_type link, const NodeType*) {
+        if(count++ != pos) return true;
+        found = link;
+        return false;
+    });
+    return found;
+}
+
+// Get the link of the node at a specified position, adding every value up to and including it to a fingerprint prefix
+template<typename T, typename Policy>
+typename FrankensteinList<T, Policy>::link_type FrankensteinList<T, Policy>::linkAt(std::size_t pos, frankenstein_fingerprint::Prefix &prefix) const {
+    if(pos >= size) {
+        throw std::out_of_range("Position is out of range.");
+    }
+
+    link_type found = null;
+    std::size_t count = 0;
+    walk(IteratorType::head, [&](link_type link, const NodeType* node) {
+        prefix.extend(node->val);
+        if(count++ != pos) return true;
+        found = link;
+        return false;
+    });
+    return found;
+}
+
+// Get the insertion predecessor of a node, walking from head without prev links
+template<typename T, typename Policy>
+typename FrankensteinList<T, Policy>::link_type FrankensteinList<T, Policy>::insertionPrev(link_type link) const {
+    if constexpr (Chains::has_prev) {
+        tally(&ListStats::prevHops);
+        return at(link)->prev;
+    } else {
+        if(link == head) return null;
+        link_type curr = head;
+        while(at(curr)->next != link) {
+            curr = at(curr)->next;
+            tally(&ListStats::nextHops);
+        }
+        return curr;
+    }
+}
+
+// Get the ascending predecessor of a node, walking from asc_head without lesser links.
+// With runs the walk starts at the head of the node's run, whose predecessor is known.
+template<typename T, typename Policy>
+typename FrankensteinList<T, Policy>::link_type FrankensteinList<T, Policy>::sortedPrev(link_type link) const {
+    if constexpr (Chains::has_lesser) {
+        tally(&ListStats::lesserHops);
+        return at(link)->lesser;
+    } else {
+        if(link == asc_head) return null;
+        link_type curr = asc_head;
+        if constexpr (grouped) {
+            const auto& run = runs[at(link)->run];
+            if(link == run.head) return runs[run.lesser].last;
+            curr = run.head;
+        }
+        while(at(curr)->greater != link) {
+            curr = at(curr)->greater;
+            tally(&ListStats::greaterHops);
+        }
+        return curr;
+    }
+}
+
+// Get the largest node, walking the ascending chain without lesser links
+template<typename T, typename Policy>
+typename FrankensteinList<T, Policy>::link_type FrankensteinList<T, Policy>::sortedLast() const {
+    if constexpr (Chains::has_lesser) {
+        return desc_head;
+    } else {
+        link_type curr = asc_head;
+        while(curr != null && at(curr)->greater != null) {
+            curr = at(curr)->greater;
+            tally(&ListStats::greaterHops);
+        }
+        return curr;
+    }
+}
+
+// Detach a node from the insertion chain given its predecessor
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::unlinkInsertion(link_type link, link_type prev) noexcept {
+    NodeType* node = at(link);
+    if(prev != null) {
+        at(prev)->next = node->next;
+    } else {
+        head = node->next;
+    }
+    if(node->next != null) {
+        if constexpr (Chains::has_prev) {
+            at(node->next)->prev = prev;
+        }
+    } else {
+        tail = prev;
+    }
+}
+
+// Detach a node from the sorted chain given its ascending predecessor
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::unlinkSorted(link_type link, link_type prev) noexcept {
+    NodeType* node = at(link);
+    if(prev != null) {
+        at(prev)->greater = node->greater;
+    } else {
+        asc_head = node->greater;
+    }
+    if constexpr (Chains::has_lesser) {
+        if(node->greater != null) {
+            at(node->greater)->lesser = prev;
+        } else {
+            desc_head = prev;
+        }
+    }
+    if constexpr (grouped) {
+        auto& run = runs[node->run];
+        if(--run.count == 0) {
+            runs.close(node->run);
+        } else if(link == run.head) {
+            run.head = node->greater;
+        } else if(link == run.last) {
+            run.last = prev;
+        }
+    }
+}
+
+// Detach a node from both chains and free it
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::destroyNode(link_type link) noexcept {
+    abortCompaction();
+    if constexpr (fingerprinted) {
+        if(link == head) {
+            fingerprint.dropFront(at(link)->val);
+        } else if(link == tail) {
+            fingerprint.dropBack(at(link)->val);
+        } else {
+            fingerprint.stale = true;
+        }
+    }
+    unlinkInsertion(link, insertionPrev(link));
+    unlinkSorted(link, sortedPrev(link));
+    freeNode(link);
+    --size;
+}
+
+// Detach a batch of nodes from both chains and free them. A chain without
+// backward links is swept once instead of being walked for every node.
+// Without the flag the caller has detached them from the sorted chain already.
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::destroyNodes(std::vector<link_type> &batch, bool sorted) {
+    if(batch.empty()) return;
+    abortCompaction();
+    if constexpr (fingerprinted) {
+        fingerprint.stale = true;
+    }
+
+    std::less<link_type> before;
+    auto doomed = [&](link_type link) {
+        return std::binary_search(batch.begin(), batch.end(), link, before);
+    };
+    if constexpr (!Chains::has_prev || !Chains::has_lesser) {
+        std::sort(batch.begin(), batch.end(), before);
+    }
+
+    if constexpr (Chains::has_prev) {
+        tally(&ListStats::prevHops, batch.size());
+        for(link_type link : batch) {
+            unlinkInsertion(link, at(link)->prev);
+        }
+    } else {
+        link_type prev = null;
+        for(link_type curr = head; curr != null; ) {
+            link_type next = at(curr)->next;
+            tally(&ListStats::nextHops);
+            if(doomed(curr)) {
+                unlinkInsertion(curr, prev);
+            } else {
+                prev = curr;
+            }
+            curr = next;
+        }
+    }
+
+    if(sorted) {
+        if constexpr (Chains::has_lesser) {
+            tally(&ListStats::lesserHops, batch.size());
+            for(link_type link : batch) {
+                unlinkSorted(link, at(link)->lesser);
+            }
+        } else {
+            link_type prev = null;
+            for(link_type curr = asc_head; curr != null; ) {
+                link_type next = at(curr)->greater;
+                tally(&ListStats::greaterHops);
+                if(doomed(curr)) {
+                    unlinkSorted(curr, prev);
+                } else {
+                    prev = curr;
+                }
+                curr = next;
+            }
+        }
+    }
+
+    for(link_type link : batch) {
+        freeNode(link);
+    }
+    size -= batch.size();
+    batch.clear();
+}
+
+// Get the run of a value, comparing it with the head of one run per distinct value
+template<typename T, typename Policy>
+std::uint32_t FrankensteinList<T, Policy>::findRun(const T &val) const {
+    const Key probe = keyOf(val);
+    for(std::uint32_t r = runs.first(); r != frankenstein_runs::none; r = runs[r].greater) {
+        const Key key = keyOf(at(runs[r].head));
+        tally(&ListStats::comparisons);
+        if(less(key, probe)) continue;
+        tally(&ListStats::comparisons);
+        return less(probe, key) ? frankenstein_runs::none : r;
+    }
+    return frankenstein_runs::none;
+}
+
+// Detach a whole run from the sorted chain by linking its neighbours to each other, then
+// free its nodes; the run is walked once to collect them, without comparing a value
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::destroyRun(std::uint32_t r) {
+    const auto run = runs[r];
+    std::vector<link_type> batch;
+    batch.reserve(run.count);
+    for(link_type curr = run.head; batch.size() < run.count; curr = at(curr)->greater) {
+        batch.push_back(curr);
+        tally(&ListStats::greaterHops);
+    }
+
+    link_type before = (run.lesser == frankenstein_runs::none) ? null : runs[run.lesser].last;
+    link_type after = at(run.last)->greater;
+    if(before != null) {
+        at(before)->greater = after;
+    } else {
+        asc_head = after;
+    }
+    if constexpr (Chains::has_lesser) {
+        if(after != null) {
+            at(after)->lesser = before;
+        } else {
+            desc_head = before;
+        }
+    }
+    runs.close(r);
+    destroyNodes(batch, false);
+}
+
+// Group the sorted chain into runs anew, one comparison per node
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::rebuildRuns() noexcept(!grouped) {
+    if constexpr (grouped) {
+        runs.clear();
+        link_type prev = null;
+        for(link_type curr = asc_head; curr != null; curr = at(curr)->greater) {
+            NodeType* node = at(curr);
+            bool equal = false;
+            if(prev != null) {
+                tally(&ListStats::comparisons);
+                equal = !less(keyOf(at(prev)), keyOf(node));
+            }
+            if(equal) {
+                auto& run = runs[runs.last()];
+                run.last = curr;
+                ++run.count;
+                node->run = runs.last();
+            } else {
+                node->run = runs.open(curr, runs.last());
+            }
+            prev = curr;
+        }
+    }
+}
+
 // Default constructor
-template<typename T>
-FrankensteinList<T>::FrankensteinList()
-        :head(nullptr), tail(nullptr), asc_head(nullptr), desc_head(nullptr), size(0)
+template<typename T, typename Policy>
+FrankensteinList<T, Policy>::FrankensteinList()
+        :head(null), tail(null), asc_head(null), desc_head(null), size(0),
+         compacting(false), compactOrder(IteratorType::head), compactCursor(null)
 {
 }
 
 // Constructor with initializer list
-template<typename T>
-FrankensteinList<T>::FrankensteinList(std::initializer_list<T> list)
-        :head(nullptr), tail(nullptr), asc_head(nullptr), desc_head(nullptr), size(0)
+template<typename T, typename Policy>
+FrankensteinList<T, Policy>::FrankensteinList(std::initializer_list<T> list)
+        :head(null), tail(null), asc_head(null), desc_head(null), size(0),
+         compacting(false), compactOrder(IteratorType::head), compactCursor(null)
 {
     for(const T& val : list) {
         push_back(val);
     }
 }
 
+// Constructor allocating the nodes from a memory resource
+template<typename T, typename Policy>
+FrankensteinList<T, Policy>::FrankensteinList(std::pmr::memory_resource *resource)
+        :nodes(resource), head(null), tail(null), asc_head(null), desc_head(null), size(0),
+         compacting(false), compactOrder(IteratorType::head), compactCursor(null)
+{
+}
+
 // Copy constructor
-template<typename T>
-FrankensteinList<T>::FrankensteinList(const FrankensteinList<T> &oth)
-        :head(nullptr), tail(nullptr), asc_head(nullptr), desc_head(nullptr), size(0)
+template<typename T, typename Policy>
+FrankensteinList<T, Policy>::FrankensteinList(const FrankensteinList &oth)
+        :head(null), tail(null), asc_head(null), desc_head(null), size(0),
+         compacting(false), compactOrder(IteratorType::head), compactCursor(null)
 {
-    Node<T>* othHead = oth.head;
-    while(othHead) {
-        this->push_back(othHead->val);
-        othHead = othHead->next;
-    }
+    Timer timer(TimedOp::copy, this);
+    copyChains(oth);
 }
 
 // Move constructor
-template<typename T>
-FrankensteinList<T>::FrankensteinList(FrankensteinList<T> &&oth) noexcept
-        :head(oth.head), tail(oth.tail), asc_head(oth.asc_head), desc_head(oth.desc_head), size(oth.size)
+template<typename T, typename Policy>
+FrankensteinList<T, Policy>::FrankensteinList(FrankensteinList &&oth) noexcept
+        :nodes((oth.abortCompaction(), std::move(oth.nodes))), head(oth.head), tail(oth.tail), asc_head(oth.asc_head), desc_head(oth.desc_head), size(oth.size),
+         compacting(false), compactOrder(IteratorType::head), compactCursor(null), journal(std::move(oth.journal))
 {
-    oth.head = nullptr;
-    oth.tail = nullptr;
-    oth.asc_head = nullptr;
-    oth.desc_head = nullptr;
+    oth.head = null;
+    oth.tail = null;
+    oth.asc_head = null;
+    oth.desc_head = null;
     oth.size = 0;
+    if constexpr (fingerprinted) {
+        fingerprint = oth.fingerprint;
+        oth.fingerprint.reset();
+    }
+    if constexpr (grouped) {
+        runs.swap(oth.runs);
+    }
+    if constexpr (indexed) {
+        hashIndex.swap(oth.hashIndex);
+    }
 }
 
 // Destructor
-template<typename T>
-FrankensteinList<T>::~FrankensteinList() {
+template<typename T, typename Policy>
+FrankensteinList<T, Policy>::~FrankensteinList() {
     clear();
 }
 
 // Copy assignment operator
-template<typename T>
-FrankensteinList<T>& FrankensteinList<T>::operator=(const FrankensteinList<T>& oth) {
+template<typename T, typename Policy>
+FrankensteinList<T, Policy>& FrankensteinList<T, Policy>::operator=(const FrankensteinList& oth) {
+    Timer timer(TimedOp::copy, this);
     if(this == &oth) {
         return *this; // Avoid self-assignment
     }
+    JournalGuard guard(*this, JournalOp::replace, oth);
     clear(); // Clear the current content of this instance
 
-    // Copy the elements from the other instance
-    Node<T>* othHead = oth.head;
-    while (othHead) {
-        push_back(othHead->val);
-        othHead = othHead->next;
-    }
+    // Copy the elements from the other instance, equal values in the same sorted order
+    copyChains(oth);
     return *this;
 }
 
 // Move assignment operator
-template<typename T>
-FrankensteinList<T>& FrankensteinList<T>::operator=(FrankensteinList<T> &&oth) noexcept {
+template<typename T, typename Policy>
+FrankensteinList<T, Policy>& FrankensteinList<T, Policy>::operator=(FrankensteinList &&oth) noexcept {
     if(this == &oth) {
         return *this; // Avoid self-assignment
     }
     clear(); // Clear the current content of this instance
 
-    // Transfer ownership of the other instance's resources
-    this->head = oth.head;
-    this->tail = oth.tail;
-    this->asc_head = oth.asc_head;
-    this->desc_head = oth.desc_head;
-    this->size = oth.size;
-
-    // Reset the other instance's pointers and size
-    oth.head = nullptr;
-    oth.tail = nullptr;
-    oth.asc_head = nullptr;
-    oth.desc_head = nullptr;
-    oth.size = 0;
-
+    // Transfer ownership of the other instance's nodes. The journal comes along with them;
+    // the old one described the discarded contents and is closed.
+    swap(oth);
+    oth.journal.reset();
     return *this;
 }
 
 // Insert an element at a specified position
-template<typename T>
-void FrankensteinList<T>::insertAt(const T &val, std::size_t pos) {
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::insertAt(const T &val, std::size_t pos) {
+    Timer timer(TimedOp::insertAt, this);
     if (pos > size) {
         throw std::out_of_range("Position is out of range.");
     }
+    JournalGuard guard(*this, JournalOp::insertAt, val, static_cast<std::uint64_t>(pos));
 
     if (pos == 0) {
         return push_front(val);
@@ -100,582 +546,2266 @@ void FrankensteinList<T>::insertAt(const T &val, std::size_t pos) {
         return push_back(val);
     }
 
-    Node<T>* node = new Node(val);
-    Node<T>* curr = getNodeAt(pos);
-    node->next = curr;
-    node->prev = curr->prev;
-    curr->prev->next = node;
-    curr->prev = node;
+    // Allocate first: growing the storage may move nodes in index mode
+    link_type link = createNode(val);
+    link_type prev;
+    if constexpr (fingerprinted) {
+        frankenstein_fingerprint::Prefix prefix;
+        prev = linkAt(pos - 1, prefix);
+        fingerprint.insert(val, prefix);
+    } else {
+        prev = linkAt(pos - 1);
+    }
+    if constexpr (indexed) {
+        // Behind the last equal node in front of the new one, found by a walk only when there is one
+        if(hashIndex.find(val)->second.count > 1) {
+            link_type equal = null;
+            for(link_type curr = head; ; curr = at(curr)->next) {
+                tally(&ListStats::comparisons);
+                if(at(curr)->val == val) equal = curr;
+                if(curr == prev) break;
+                tally(&ListStats::nextHops);
+            }
+            indexMove(link, equal);
+        }
+    }
+    NodeType* node = at(link);
+    NodeType* prevNode = at(prev);
+    node->next = prevNode->next;
+    prevNode->next = link;
+    if constexpr (Chains::has_prev) {
+        node->prev = prev;
+        at(node->next)->prev = link;
+    }
+
+    ++size;
+    PutInSortedOrder(link);
+}
+
+// Helper function for maintaining sorted order, one pass links both directions
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::PutInSortedOrder(link_type link) {
+    if (link == null) return;
+    NodeType* node = at(link);
+    tally(&ListStats::sortedInsertions);
+
+    // Find the ascending predecessor: the last node smaller than the new one
+    link_type prev = null;
+    std::uint32_t joined = frankenstein_runs::none;// Run of the equal values the node joins
+    std::uint32_t before = frankenstein_runs::none;// Run the predecessor belongs to
+    if constexpr (Chains::has_lesser) {
+        // Appending a new maximum needs no walk; a duplicate of the maximum walks like any other
+        if (desc_head != null) {
+            tally(&ListStats::comparisons);
+            if (less(keyOf(at(desc_head)), keyOf(node))) {
+                prev = desc_head;
+                if constexpr (grouped) {
+                    before = runs.last();
+                }
+            }
+        }
+    }
+    if constexpr (grouped) {
+        // Step from run to run; a duplicate goes in front of its run in O(1) once the run is found
+        if (prev == null) {
+            for (std::uint32_t r = runs.first(); r != frankenstein_runs::none; r = runs[r].greater) {
+                const Key key = keyOf(at(runs[r].head));
+                tally(&ListStats::comparisons);
+                if (!less(key, keyOf(node))) {
+                    tally(&ListStats::comparisons);
+                    if (!less(keyOf(node), key)) joined = r;
+                    break;
+                }
+                before = r;
+            }
+            prev = (before == frankenstein_runs::none) ? null : runs[before].last;
+        }
+    } else if (prev == null && asc_head != null) {
+        tally(&ListStats::comparisons);
+        if (less(keyOf(at(asc_head)), keyOf(node))) {
+            prev = asc_head;
+            NodeType* curr = at(prev);
+            while (curr->greater != null) {
+                tally(&ListStats::comparisons);
+                if (!less(keyOf(at(curr->greater)), keyOf(node))) break;
+                tally(&ListStats::greaterHops);
+                prev = curr->greater;
+                curr = at(prev);
+            }
+        }
+    }
+
+    if (prev == null) {
+        node->greater = asc_head;
+        asc_head = link;
+    } else {
+        NodeType* prevNode = at(prev);
+        node->greater = prevNode->greater;
+        prevNode->greater = link;
+    }
+
+    if constexpr (Chains::has_lesser) {
+        node->lesser = prev;
+        if (node->greater != null) {
+            at(node->greater)->lesser = link;
+        } else {
+            desc_head = link;
+        }
+    }
+
+    if constexpr (grouped) {
+        if (joined == frankenstein_runs::none) {
+            node->run = runs.open(link, before);
+        } else {
+            auto& run = runs[joined];
+            run.head = link;
+            ++run.count;
+            node->run = joined;
+        }
+    }
+}
 
+// Append a node to the insertion chain only, the caller links the sorted chain
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::appendUnsorted(link_type link) noexcept {
+    NodeType* node = at(link);
+    node->next = null;
+    if constexpr (Chains::has_prev) {
+        node->prev = tail;
+    }
+    if(tail != null) {
+        at(tail)->next = link;
+    } else {
+        head = link;
+    }
+    tail = link;
     ++size;
-    PutInSortedOrder(node);
+    if constexpr (fingerprinted) {
+        fingerprint.append(node->val);
+    }
+}
+
+// Rebuild the sorted chain from nodes given in ascending order
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::linkSortedChain(const std::vector<link_type> &ascending) noexcept(!grouped) {
+    asc_head = ascending.empty() ? null : ascending.front();
+    desc_head = null;
+    link_type prev = null;
+    for(link_type link : ascending) {
+        NodeType* node = at(link);
+        node->greater = null;
+        if constexpr (Chains::has_lesser) {
+            node->lesser = prev;
+        }
+        if(prev != null) {
+            at(prev)->greater = link;
+        }
+        prev = link;
+    }
+    if constexpr (Chains::has_lesser) {
+        desc_head = prev;
+    }
+    rebuildRuns();
+}
+
+// Make the sorted chain follow the insertion chain, for lists built in ascending order
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::linkSortedAlongInsertion() noexcept(!grouped) {
+    link_type prev = null;
+    for(link_type curr = head; curr != null; curr = at(curr)->next) {
+        NodeType* node = at(curr);
+        node->greater = node->next;
+        if constexpr (Chains::has_lesser) {
+            node->lesser = prev;
+        }
+        prev = curr;
+    }
+    asc_head = head;
+    if constexpr (Chains::has_lesser) {
+        desc_head = tail;
+    }
+    rebuildRuns();
+}
+
+// Fill an empty list with copies of another list's nodes, both chains linked as they are
+// there; equal values keep their sorted order, which pushing the values again would not.
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::copyChains(const FrankensteinList &oth) {
+    std::vector<std::pair<link_type, link_type>> copies;// Every node of the other list with its copy
+    copies.reserve(oth.size);
+    try {
+        oth.walk(IteratorType::head, [&](link_type link, const NodeType* node) {
+            link_type copy = createNode(node->val);
+            appendUnsorted(copy);
+            copies.emplace_back(link, copy);
+            return true;
+        });
+    } catch(...) {
+        clear();
+        throw;
+    }
+
+    std::less<link_type> before;
+    std::sort(copies.begin(), copies.end(), [&](const auto& a, const auto& b) {
+        return before(a.first, b.first);
+    });
+    std::vector<link_type> ascending;
+    ascending.reserve(copies.size());
+    oth.walk(IteratorType::asc_head, [&](link_type link, const NodeType*) {
+        auto found = std::lower_bound(copies.begin(), copies.end(), link, [&](const auto& entry, link_type key) {
+            return before(entry.first, key);
+        });
+        ascending.push_back(found->second);
+        return true;
+    });
+    linkSortedChain(ascending);
+}
+
+// Stop an incremental compaction, nodes already moved stay where they are
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::abortCompaction() noexcept {
+    if(!compacting) return;
+    if constexpr (pointer_links) {
+        nodes.closeSlab();
+    }
+    compacting = false;
+    compactCursor = null;
+}
+
+// Walk a chain in insertion or ascending order. With jump hints every step prefetches
+// the node the hint names and points the hint of the node visited Distance steps earlier
+// at the current one, so the next walk finds its hints fresh. Visit must not free nodes.
+template<typename T, typename Policy>
+template<typename Visit>
+void FrankensteinList<T, Policy>::walk(IteratorType order, Visit &&visit) const {
+    const bool byInsertion = (order == IteratorType::head);
+    link_type curr = byInsertion ? head : asc_head;
+    if constexpr (hint_distance == 0) {
+        while(curr != null) {
+            NodeType* node = at(curr);
+            link_type next = byInsertion ? node->next : node->greater;
+            tally(byInsertion ? &ListStats::nextHops : &ListStats::greaterHops);
+            if(!visit(curr, node)) return;
+            curr = next;
+        }
+    } else {
+        NodeType* behind[hint_distance] = {};// The last nodes visited, oldest at step % hint_distance
+        for(std::size_t step = 0; curr != null; ++step) {
+            NodeType* node = at(curr);
+            Storage::prefetch(&nodes, byInsertion ? node->next_hint : node->greater_hint);
+            NodeType*& trailing = behind[step % hint_distance];
+            if(trailing) {
+                (byInsertion ? trailing->next_hint : trailing->greater_hint) = curr;
+            }
+            trailing = node;
+
+            link_type next = byInsertion ? node->next : node->greater;
+            tally(byInsertion ? &ListStats::nextHops : &ListStats::greaterHops);
+            if(!visit(curr, node)) return;
+            curr = next;
+        }
+    }
+}
+
+// Get a pointer to the node at a specified position
+template<typename T, typename Policy>
+typename FrankensteinList<T, Policy>::NodeType* FrankensteinList<T, Policy>::getNodeAt(std::size_t pos) {
+    Timer timer(TimedOp::getNodeAt, this);
+    return at(linkAt(pos));
+}
+
+// Insert an element at the front
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::push_front(const T &val) {
+    Timer timer(TimedOp::push_front, this);
+    JournalGuard guard(*this, JournalOp::push_front, val);
+    link_type link = createNode(val);
+    if(head != null) {
+        if constexpr (Chains::has_prev) {
+            at(head)->prev = link;
+        }
+    } else {
+        tail = link;
+    }
+    at(link)->next = head;
+    head = link;
+    ++size;
+    if constexpr (fingerprinted) {
+        fingerprint.prepend(val);
+    }
+    if constexpr (indexed) {
+        indexMove(link, null);
+    }
+    PutInSortedOrder(link);
+}
+
+// Remove the element from the front
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::pop_front() {
+    Timer timer(TimedOp::pop_front, this);
+    if (head == null) {
+        throw std::runtime_error("List is empty. Cannot pop_front.");
+    }
+    JournalGuard guard(*this, JournalOp::pop_front);
+    destroyNode(head);
+}
+
+// Get a reference to the front element
+template<typename T, typename Policy>
+T& FrankensteinList<T, Policy>::front() {
+    if(head == null) {
+        throw std::runtime_error("List is empty. Cannot access front element.");
+    }
+    return at(head)->val;
+}
+
+// Insert an element at the back
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::push_back(const T &val) {
+    Timer timer(TimedOp::push_back, this);
+    JournalGuard guard(*this, JournalOp::push_back, val);
+    link_type link = createNode(val);
+    if(head == null) {
+        head = link;
+        tail = link;
+    } else {
+        at(tail)->next = link;
+        if constexpr (Chains::has_prev) {
+            at(link)->prev = tail;
+        }
+        tail = link;
+    }
+    ++size;
+    if constexpr (fingerprinted) {
+        fingerprint.append(val);
+    }
+    PutInSortedOrder(link);
+}
+
+// Remove the element from the back
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::pop_back() {
+    Timer timer(TimedOp::pop_back, this);
+    if (tail == null) {
+        throw std::runtime_error("List is empty. Cannot pop_back.");
+    }
+    JournalGuard guard(*this, JournalOp::pop_back);
+    destroyNode(tail);
+}
+
+// Get a reference to the back element
+template<typename T, typename Policy>
+T& FrankensteinList<T, Policy>::back() {
+    if(tail == null) {
+        throw std::runtime_error("List is empty. Cannot access back element.");
+    }
+    return at(tail)->val;
+}
+
+// Check if the list is empty
+template<typename T, typename Policy>
+bool FrankensteinList<T, Policy>::empty() const {
+    return size == 0;
+}
+
+// Reverse the order of elements in the list
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::reverse() {
+    Timer timer(TimedOp::reverse, this);
+    // If the list is empty or has only one element, no need to reverse
+    if(size <= 1) return;
+    JournalGuard guard(*this, JournalOp::reverse);
+
+    // Traverse the list and turn every next link around
+    link_type prev = null;
+    link_type curr = head;
+    while(curr != null) {
+        NodeType* node = at(curr);
+        link_type next = node->next;
+        tally(&ListStats::nextHops);
+        node->next = prev;
+        if constexpr (Chains::has_prev) {
+            node->prev = next;
+        }
+        prev = curr;
+        curr = next;
+    }
+
+    // Swap the head and tail pointers
+    std::swap(head, tail);
+    if constexpr (fingerprinted) {
+        fingerprint.reverse();
+    }
+    if constexpr (indexed) {
+        // Every group is reversed as well
+        for(link_type curr = head; curr != null; curr = at(curr)->next) {
+            NodeType* node = at(curr);
+            std::swap(node->equal_prev, node->equal_next);
+        }
+        for(auto& entry : hashIndex) {
+            std::swap(entry.second.first, entry.second.last);
+        }
+    }
+}
+
+// Function to remove duplicate elements in the list
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::unique() {
+    Timer timer(TimedOp::unique, this);
+    if(asc_head == null) return;// If the list is empty, return
+    JournalGuard guard(*this, JournalOp::unique);
+
+    // Equal values are adjacent in the sorted chain, keep the last node of every run
+    std::vector<link_type> duplicates;
+    if constexpr (grouped) {
+        // The runs say where the duplicates are, no value is compared
+        duplicates.reserve(size - runs.runs());
+        for(std::uint32_t r = runs.first(); r != frankenstein_runs::none; r = runs[r].greater) {
+            link_type curr = runs[r].head;
+            for(std::size_t k = 1; k < runs[r].count; ++k) {
+                duplicates.push_back(curr);
+                curr = at(curr)->greater;
+                tally(&ListStats::greaterHops);
+            }
+        }
+        destroyNodes(duplicates);
+        return;
+    } else if constexpr (indexed) {
+        // One pass over the groups: a node goes when its sorted successor holds the same value
+        duplicates.reserve(size - hashIndex.size());
+        for(const auto& entry : hashIndex) {
+            if(entry.second.count == 1) continue;
+            for(link_type curr = entry.second.first; curr != null; curr = at(curr)->equal_next) {
+                const NodeType* node = at(curr);
+                if(node->greater == null) continue;
+                tally(&ListStats::comparisons);
+                if(equal(keyOf(at(node->greater)), keyOf(node))) {
+                    duplicates.push_back(curr);
+                }
+            }
+        }
+        destroyNodes(duplicates);
+        return;
+    }
+    walk(IteratorType::asc_head, [&](link_type link, const NodeType* node) {
+        if(node->greater != null) {
+            tally(&ListStats::comparisons);
+            if(equal(keyOf(node), keyOf(at(node->greater)))) {
+                duplicates.push_back(link);
+            }
+        }
+        return true;
+    });
+    destroyNodes(duplicates);
+}
+
+
+// Function to merge another list into this list
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::merge(FrankensteinList &oth) {
+    Timer timer(TimedOp::merge, this);
+    if(this == &oth) return;
+    JournalGuard guard(*this, JournalOp::merge, oth);
+    JournalGuard cleared(oth, JournalOp::clear);
+
+    oth.walk(IteratorType::head, [this](link_type, const NodeType* node) {
+        push_back(node->val);
+        return true;
+    });
+    oth.clear();
+}
+
+// Function to remove all occurrences of a value from the list
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::remove(const T &val) {
+    Timer timer(TimedOp::remove, this);
+    JournalGuard guard(*this, JournalOp::remove, val);
+    if constexpr (indexed) {
+        // The index names the matches, k of them are unlinked without a search
+        auto entry = hashIndex.find(val);
+        if(entry == hashIndex.end()) return;
+        std::vector<link_type> matches;
+        matches.reserve(entry->second.count);
+        for(link_type curr = entry->second.first; curr != null; curr = at(curr)->equal_next) {
+            matches.push_back(curr);
+        }
+        destroyNodes(matches);
+        return;
+    } else if constexpr (grouped) {
+        std::uint32_t run = findRun(val);
+        if(run != frankenstein_runs::none) {
+            destroyRun(run);
+        }
+        return;
+    }
+    // The matches are one run of the sorted chain, stop as soon as it is passed
+    std::vector<link_type> matches;
+    const Key probe = keyOf(val);
+    walk(IteratorType::asc_head, [&](link_type link, const NodeType* node) {
+        tally(&ListStats::comparisons);
+        if(equal(keyOf(node), probe)) {
+            matches.push_back(link);
+        } else if(tally(&ListStats::comparisons), less(probe, keyOf(node))) {
+            return false;
+        }
+        return true;
+    });
+    destroyNodes(matches);
+}
+
+// Function to erase an element at a specific position
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::erase(const T &pos) {
+    Timer timer(TimedOp::erase, this);
+    if(pos < 0 || static_cast<std::size_t>(pos) >= size) {
+        throw std::out_of_range("Position is out of range.");
+    }
+    JournalGuard guard(*this, JournalOp::erase, static_cast<std::uint64_t>(pos));
+    link_type prev = null;
+    if constexpr (fingerprinted) {
+        frankenstein_fingerprint::Prefix prefix;
+        prev = (pos == 0) ? null : linkAt(pos - 1, prefix);
+        link_type doomed = (prev == null) ? head : at(prev)->next;
+        if(prev == null) {
+            fingerprint.dropFront(at(doomed)->val);
+        } else if(doomed == tail) {
+            fingerprint.dropBack(at(doomed)->val);
+        } else {
+            fingerprint.erase(at(doomed)->val, prefix);
+        }
+    } else {
+        prev = (pos == 0) ? null : linkAt(pos - 1);
+    }
+    link_type curr = (prev == null) ? head : at(prev)->next;
+    abortCompaction();
+    unlinkInsertion(curr, prev);
+    unlinkSorted(curr, sortedPrev(curr));
+    freeNode(curr);// Delete the node at the specified position
+    --size;
+}
+
+// Function to erase a range of elements starting from a specific position
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::erase(const T &pos, std::size_t count) {
+    Timer timer(TimedOp::eraseRange, this);
+    if(pos < 0 || static_cast<std::size_t>(pos) > size || static_cast<std::size_t>(pos) + count > size) {
+        throw std::out_of_range("Position is out of range.");
+    }
+    if(count == 0) return;
+    JournalGuard guard(*this, JournalOp::eraseRange, static_cast<std::uint64_t>(pos), static_cast<std::uint64_t>(count));
+
+    std::vector<link_type> range;
+    range.reserve(count);
+    for(link_type curr = linkAt(pos); count; --count) {
+        range.push_back(curr);
+        curr = at(curr)->next;
+        tally(&ListStats::nextHops);
+    }
+    destroyNodes(range);// Delete nodes in the specified range
+}
+
+// Function to sort the list
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::sort() {
+    Timer timer(TimedOp::sort, this);
+    if(head == null) return;// If the list is empty, return
+    JournalGuard guard(*this, JournalOp::sort);
+
+    head = asc_head;
+    link_type prev = null;
+    for(link_type curr = head; curr != null; curr = at(curr)->next) {
+        NodeType* node = at(curr);
+        node->next = node->greater;
+        tally(&ListStats::greaterHops);
+        if constexpr (Chains::has_prev) {
+            node->prev = prev;
+        }
+        prev = curr;
+    }
+    tail = prev;
+    if constexpr (fingerprinted) {
+        fingerprint.stale = true;
+    }
+    if constexpr (indexed) {
+        reindexOrder();
+    }
+}
+
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::resize(std::size_t newSize) {
+    Timer timer(TimedOp::resize, this);
+    JournalGuard guard(*this, JournalOp::resize, static_cast<std::uint64_t>(newSize));
+    while(size > newSize) {
+        pop_back();
+    }
+    while(size < newSize) {
+        push_back(0); // Default-constructed elements
+    }
+}
+
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::emplace_front(std::size_t newSize) {
+    Timer timer(TimedOp::emplace_front, this);
+    if(newSize == size) return;// If 'newSize' is the same as the current size, no action is needed.
+    JournalGuard guard(*this, JournalOp::emplace_front, static_cast<std::uint64_t>(newSize));
+    if(newSize > size) {
+        std::size_t count = newSize - size;
+        while(count) {
+            push_front(0);// Add elements with value 0 to the front
+            --count;
+        }
+    } else {
+        std::size_t count = size - newSize;
+        while(count) {
+            pop_front();// Remove elements from the front
+            --count;
+        }
+    }
+}
+
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::splice(std::size_t pos, const FrankensteinList &list) {
+    Timer timer(TimedOp::splice, this);
+    if(this == &list) {
+        FrankensteinList copy(list);
+        return splice(pos, copy);
+    }
+    if(pos > size && list.size) {
+        throw std::out_of_range("Position is out of range.");
+    }
+    JournalGuard guard(*this, JournalOp::splice, static_cast<std::uint64_t>(pos), list);
+
+    // Iterate through the elements in 'list' using a constant iterator.
+    ConstIterator it = list.cbegin();
+    while(it != list.cend()) {
+        // Insert each element from 'list' into the current list at the specified 'pos'.
+        insertAt(*it, pos);
+        // Move to the next element in 'list'.
+        ++it;
+    }
+}
+
+// Assign a specified number of elements with the given value.
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::assign(std::size_t count, const T& val) {
+    Timer timer(TimedOp::assign, this);
+    const T copy(val);
+    JournalGuard guard(*this, JournalOp::assign, copy, static_cast<std::uint64_t>(count));
+    clear();
+    while(count) {
+        push_back(copy);
+        --count;
+    }
+}
+
+// Exchange the contents of two lists
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::swap(FrankensteinList &oth) noexcept {
+    using std::swap;
+    abortCompaction();
+    oth.abortCompaction();
+    nodes.swap(oth.nodes);
+    swap(head, oth.head);
+    swap(tail, oth.tail);
+    swap(asc_head, oth.asc_head);
+    swap(desc_head, oth.desc_head);
+    swap(size, oth.size);
+    journal.swap(oth.journal);
+    if constexpr (fingerprinted) {
+        swap(fingerprint, oth.fingerprint);
+    }
+    if constexpr (grouped) {
+        runs.swap(oth.runs);
+    }
+    if constexpr (indexed) {
+        hashIndex.swap(oth.hashIndex);
+    }
+}
+
+// Check whether a value is present
+template<typename T, typename Policy>
+bool FrankensteinList<T, Policy>::contains(const T &val) const {
+    Timer timer(TimedOp::contains, this);
+    if constexpr (indexed) {
+        return hashIndex.find(val) != hashIndex.end();
+    } else if constexpr (grouped) {
+        return findRun(val) != frankenstein_runs::none;
+    }
+    if constexpr (Storage::scannable) {
+        // A flat pass over inline slots beats chasing the sorted chain
+        bool found = false;
+        if(nodes.scan([&](const NodeType& node) { found |= (node.val == val); })) {
+            tally(&ListStats::comparisons, size);
+            return found;
+        }
+    }
+
+    bool found = false;
+    const Key probe = keyOf(val);
+    walk(IteratorType::asc_head, [&](link_type, const NodeType* node) {
+        found = equal(keyOf(node), probe);
+        tally(&ListStats::comparisons, found ? 1 : 2);
+        return !found && !less(probe, keyOf(node));
+    });
+    return found;
+}
+
+// Count the occurrences of a value, the matches are one run of the sorted chain
+template<typename T, typename Policy>
+std::size_t FrankensteinList<T, Policy>::count(const T &val) const {
+    Timer timer(TimedOp::count, this);
+    if constexpr (indexed) {
+        auto entry = hashIndex.find(val);
+        return (entry == hashIndex.end()) ? 0 : entry->second.count;
+    } else if constexpr (grouped) {
+        // The length of the run, however long it is
+        std::uint32_t run = findRun(val);
+        return (run == frankenstein_runs::none) ? 0 : runs[run].count;
+    }
+    std::size_t found = 0;
+    if constexpr (Storage::scannable) {
+        if(nodes.scan([&](const NodeType& node) { found += (node.val == val); })) {
+            tally(&ListStats::comparisons, size);
+            return found;
+        }
+    }
+
+    const Key probe = keyOf(val);
+    walk(IteratorType::asc_head, [&](link_type, const NodeType* node) {
+        if(equal(keyOf(node), probe)) {
+            ++found;
+        }
+        tally(&ListStats::comparisons, 2);
+        return !less(probe, keyOf(node));
+    });
+    return found;
+}
+
+// Get the first node holding a value in insertion order, null when absent
+template<typename T, typename Policy>
+typename FrankensteinList<T, Policy>::NodeType* FrankensteinList<T, Policy>::find_first_inserted(const T &val) {
+    Timer timer(TimedOp::findFirstInserted, this);
+    if constexpr (indexed) {
+        auto entry = hashIndex.find(val);
+        return (entry == hashIndex.end()) ? nullptr : at(entry->second.first);
+    }
+
+    link_type found = null;
+    walk(IteratorType::head, [&](link_type link, const NodeType* node) {
+        tally(&ListStats::comparisons);
+        if(!(node->val == val)) return true;
+        found = link;
+        return false;
+    });
+    return (found == null) ? nullptr : at(found);
+}
+
+// Walk the sorted chains of two lists in lockstep. Equal values are paired off one to one,
+// so a value occurring three times here and once there gives one pair and two singles.
+template<typename T, typename Policy>
+template<typename Visit>
+void FrankensteinList<T, Policy>::pairSorted(const FrankensteinList &first, const FrankensteinList &second, Visit &&visit) {
+    link_type a = first.asc_head;
+    link_type b = second.asc_head;
+    while(a != null || b != null) {
+        bool firstLess = (b == null);
+        bool secondLess = (a == null);
+        if(a != null && b != null) {
+            first.tally(&ListStats::comparisons);
+            firstLess = first.at(a)->val < second.at(b)->val;
+            if(!firstLess) {
+                first.tally(&ListStats::comparisons);
+                secondLess = second.at(b)->val < first.at(a)->val;
+            }
+        }
+        if(firstLess) {
+            link_type next = first.at(a)->greater;
+            first.tally(&ListStats::greaterHops);
+            visit(a, null);
+            a = next;
+        } else if(secondLess) {
+            link_type next = second.at(b)->greater;
+            second.tally(&ListStats::greaterHops);
+            visit(null, b);
+            b = next;
+        } else {
+            link_type nextA = first.at(a)->greater;
+            link_type nextB = second.at(b)->greater;
+            first.tally(&ListStats::greaterHops);
+            second.tally(&ListStats::greaterHops);
+            visit(a, b);
+            a = nextA;
+            b = nextB;
+        }
+    }
+}
+
+// New list of the named parts of two lists. A matched pair contributes the value of the first list.
+// The values arrive in ascending order, so both chains are linked without comparing anything.
+template<typename T, typename Policy>
+FrankensteinList<T, Policy> FrankensteinList<T, Policy>::combine(const FrankensteinList &first, const FrankensteinList &second, unsigned keep) {
+    FrankensteinList result;
+    pairSorted(first, second, [&](link_type a, link_type b) {
+        unsigned part = (a == null) ? onlySecond : (b == null) ? onlyFirst : inBoth;
+        if(!(keep & part)) return;
+        result.appendUnsorted(result.createNode(a != null ? first.at(a)->val : second.at(b)->val));
+    });
+    result.linkSortedAlongInsertion();
+    return result;
+}
+
+// Keep the named parts of this list and the other one. Surviving nodes stay where they are, values
+// taken from the other list are moved into new nodes at the back and the sorted chain is relinked
+// in the lockstep order.
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::combineWith(FrankensteinList &oth, unsigned keep, JournalOp op) {
+    if(this == &oth) {
+        // Every value is its own partner
+        if(!(keep & inBoth)) {
+            JournalGuard guard(*this, op, oth);
+            clear();
+        }
+        return;
+    }
+    JournalGuard guard(*this, op, oth);
+    JournalGuard cleared(oth, JournalOp::clear);
+    if constexpr (grouped) {
+        runs.reserve(oth.runs.runs());// Regrouping the result cannot fail then
+    }
+
+    // Decide first, nodes are only created once both chains are walked
+    std::vector<std::pair<link_type, link_type>> pairs;
+    pairs.reserve(size + oth.size);
+    pairSorted(*this, oth, [&pairs](link_type a, link_type b) {
+        pairs.emplace_back(a, b);
+    });
+
+    std::vector<link_type> doomed;
+    for(const auto& [a, b] : pairs) {
+        if(a != null && !(keep & ((b == null) ? onlyFirst : inBoth))) doomed.push_back(a);
+    }
+    destroyNodes(doomed);
+
+    auto kept = [keep](link_type a, link_type b) {
+        return a != null && (keep & ((b == null) ? onlyFirst : inBoth));
+    };
+    std::vector<link_type> ascending;
+    ascending.reserve(pairs.size());
+    std::size_t done = 0;
+    try {
+        for(; done < pairs.size(); ++done) {
+            auto [a, b] = pairs[done];
+            if(a == null && (keep & onlySecond)) {
+                link_type link = createNode(std::move(oth.at(b)->val));
+                appendUnsorted(link);
+                ascending.push_back(link);
+            } else if(kept(a, b)) {
+                ascending.push_back(a);
+            }
+        }
+    } catch(...) {
+        // The values taken so far stay, the sorted chain must hold every node
+        for(; done < pairs.size(); ++done) {
+            if(kept(pairs[done].first, pairs[done].second)) ascending.push_back(pairs[done].first);
+        }
+        linkSortedChain(ascending);
+        throw;
+    }
+    linkSortedChain(ascending);
+    oth.clear();
 }
 
-// Helper function for maintaining sorted order
-template<typename T>
-void FrankensteinList<T>::PutInSortedOrder(Node<T> *node) {
-    if (!node) return;
+// Keep every value as often as it occurs in either list
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::set_union_with(FrankensteinList &oth) {
+    Timer timer(TimedOp::setUnion, this);
+    combineWith(oth, onlyFirst | onlySecond | inBoth, JournalOp::setUnion);
+}
+
+// Keep every value as often as it occurs in both lists
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::set_intersection_with(FrankensteinList &oth) {
+    Timer timer(TimedOp::setIntersection, this);
+    combineWith(oth, inBoth, JournalOp::setIntersection);
+}
+
+// Drop one occurrence of a value per occurrence in the other list
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::set_difference_with(FrankensteinList &oth) {
+    Timer timer(TimedOp::setDifference, this);
+    combineWith(oth, onlyFirst, JournalOp::setDifference);
+}
+
+// Keep the occurrences without a partner in the other list
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::set_symmetric_difference_with(FrankensteinList &oth) {
+    Timer timer(TimedOp::setSymmetricDifference, this);
+    combineWith(oth, onlyFirst | onlySecond, JournalOp::setSymmetricDifference);
+}
+
+// Thread counts of merge_all
+namespace frankenstein_merge {
+    constexpr std::size_t parallelValues = 1 << 20;// Values below which merge_all stays on one thread
+    constexpr std::size_t valuesPerThread = 1 << 18;// Values each additional thread should have to merge at least
+    constexpr std::size_t samplesPerThread = 8;// Samples per run and thread for picking the partition splitters
+}
+
+// k-way merge along the sorted chains. Every chain is first read into a run of value pointers,
+// then a heap ordered by value and list index merges the runs, so equal values keep the order
+// of the lists and of their own chain. On several threads the runs are cut at sampled splitter
+// values into independent pieces (merge path) that are merged into their slots side by side.
+// The nodes are created afterwards on this thread, the storage is not shared.
+template<typename T, typename Policy>
+FrankensteinList<T, Policy> FrankensteinList<T, Policy>::mergeLists(const std::vector<const FrankensteinList*> &lists, unsigned threads) {
+    namespace mrg = frankenstein_merge;
+    std::size_t total = 0;
+    for(const FrankensteinList* list : lists) {
+        total += list->size;
+    }
+    if(threads == 0) {
+        std::size_t cores = std::max(1u, std::thread::hardware_concurrency());
+        threads = total < mrg::parallelValues ? 1 : static_cast<unsigned>(std::min(cores, total / mrg::valuesPerThread));
+    }
+
+    // Run t of the lists on thread t, rethrowing the first failure once all are done
+    auto parallel = [threads](auto &&work) {
+        std::vector<std::exception_ptr> failures(threads);
+        std::vector<std::thread> helpers;
+        for(unsigned t = 1; t < threads; ++t) {
+            helpers.emplace_back([&work, &failures, t] {
+                try {
+                    work(t);
+                } catch(...) {
+                    failures[t] = std::current_exception();
+                }
+            });
+        }
+        try {
+            work(0u);
+        } catch(...) {
+            failures[0] = std::current_exception();
+        }
+        for(std::thread& helper : helpers) {
+            helper.join();
+        }
+        for(const std::exception_ptr& failure : failures) {
+            if(failure) std::rethrow_exception(failure);
+        }
+    };
+
+    using Run = std::vector<const T*>;
+    std::vector<Run> runs(lists.size());
+    parallel([&](unsigned t) {
+        for(std::size_t i = t; i < lists.size(); i += threads) {
+            runs[i].reserve(lists[i]->size);
+            lists[i]->walk(IteratorType::asc_head, [&run = runs[i]](link_type, const NodeType* node) {
+                run.push_back(&node->val);
+                return true;
+            });
+        }
+    });
+
+    // Piece t of every run: bounds[t][i] to bounds[t + 1][i]
+    std::vector<std::vector<std::size_t>> bounds(threads + 1, std::vector<std::size_t>(runs.size(), 0));
+    for(std::size_t i = 0; i < runs.size(); ++i) {
+        bounds[threads][i] = runs[i].size();
+    }
+    if(threads > 1) {
+        std::vector<const T*> samples;
+        std::size_t perRun = threads * mrg::samplesPerThread;
+        for(const Run& run : runs) {
+            for(std::size_t k = 1; k <= perRun && !run.empty(); ++k) {
+                samples.push_back(run[(run.size() - 1) * k / perRun]);
+            }
+        }
+        std::sort(samples.begin(), samples.end(), [](const T* a, const T* b) { return *a < *b; });
+        for(unsigned t = 1; t < threads && !samples.empty(); ++t) {
+            const T& splitter = *samples[samples.size() * t / threads];
+            for(std::size_t i = 0; i < runs.size(); ++i) {
+                auto cut = std::lower_bound(runs[i].begin(), runs[i].end(), splitter, [](const T* a, const T& b) { return *a < b; });
+                bounds[t][i] = static_cast<std::size_t>(cut - runs[i].begin());
+            }
+        }
+        if(samples.empty()) {
+            for(unsigned t = 1; t < threads; ++t) bounds[t] = bounds[threads];
+        }
+    }
+
+    std::vector<const T*> merged(total);
+    parallel([&](unsigned t) {
+        struct Cursor {
+            const T* const* pos;
+            const T* const* end;
+            std::size_t list;
+        };
+        auto after = [](const Cursor& a, const Cursor& b) {
+            return **b.pos < **a.pos || (!(**a.pos < **b.pos) && b.list < a.list);
+        };
+        std::vector<Cursor> heap;
+        std::size_t out = 0;
+        for(std::size_t i = 0; i < runs.size(); ++i) {
+            out += bounds[t][i];
+            if(bounds[t][i] != bounds[t + 1][i]) {
+                heap.push_back(Cursor{runs[i].data() + bounds[t][i], runs[i].data() + bounds[t + 1][i], i});
+            }
+        }
+        std::make_heap(heap.begin(), heap.end(), after);
+        while(!heap.empty()) {
+            std::pop_heap(heap.begin(), heap.end(), after);
+            Cursor& least = heap.back();
+            merged[out++] = *least.pos;
+            if(++least.pos == least.end) {
+                heap.pop_back();
+            } else {
+                std::push_heap(heap.begin(), heap.end(), after);
+            }
+        }
+    });
+    runs = {};
+
+    FrankensteinList result;
+    for(const T* val : merged) {
+        result.appendUnsorted(result.createNode(*val));
+    }
+    result.linkSortedAlongInsertion();
+    return result;
+}
+
+// Follow a next/prev/greater/lesser link of a node
+template<typename T, typename Policy>
+typename FrankensteinList<T, Policy>::NodeType* FrankensteinList<T, Policy>::resolve(link_type link) const {
+    return at(link);
+}
+
+// Get the memory resource the nodes come from
+template<typename T, typename Policy>
+std::pmr::memory_resource* FrankensteinList<T, Policy>::getMemoryResource() const {
+    return nodes.resource();
+}
+
+// Get a pointer to the head of the list
+template<typename T, typename Policy>
+typename FrankensteinList<T, Policy>::NodeType* FrankensteinList<T, Policy>::getHead() const {
+    return at(head);
+}
+
+// Set a pointer to the head of the list
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::setHead(NodeType* h) {
+    head = nodes.ref(h);
+    if constexpr (fingerprinted) {
+        fingerprint.stale = true;
+    }
+}
+
+// Get a pointer to the tail of the list
+template<typename T, typename Policy>
+typename FrankensteinList<T, Policy>::NodeType* FrankensteinList<T, Policy>::getTail() const {
+    return at(tail);
+}
+
+// Set a pointer to the tail of the list
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::setTail(NodeType *t) {
+    tail = nodes.ref(t);
+    if constexpr (fingerprinted) {
+        fingerprint.stale = true;
+    }
+}
+
+// Get a pointer to the ascending head of the list
+template<typename T, typename Policy>
+typename FrankensteinList<T, Policy>::NodeType* FrankensteinList<T, Policy>::getAscHead() const {
+    return at(asc_head);
+}
+// Set a pointer to the ascending head of the list
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::setAscHead(NodeType *aH) {
+    asc_head = nodes.ref(aH);
+}
+
+// Get a pointer to the descending head of the list
+template<typename T, typename Policy>
+typename FrankensteinList<T, Policy>::NodeType* FrankensteinList<T, Policy>::getDescHead() const {
+    return at(sortedLast());
+}
+
+// Set a pointer to the descending head of the list
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::setDescHead(NodeType *dH) {
+    if constexpr (Chains::has_lesser) {
+        desc_head = nodes.ref(dH);
+    }
+}
+
+// Get the current size of the list
+template<typename T, typename Policy>
+int FrankensteinList<T, Policy>::getSize() const {
+    return size;
+}
+
+// Get the current size of the list
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::setSize(int s) {
+    size = s;
+    if constexpr (fingerprinted) {
+        fingerprint.stale = true;
+    }
+}
+
+// Snapshot of the work counters since the last reset
+template<typename T, typename Policy>
+ListStats FrankensteinList<T, Policy>::stats() const {
+    if constexpr (counting) {
+        return counters;
+    } else {
+        return ListStats();
+    }
+}
+
+// Set the work counters to zero
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::resetStats() {
+    if constexpr (counting) {
+        counters = ListStats();
+    }
+}
+
+// Bytes of values, links, free slots, allocator slack and overhead. Inline slots are part of
+// the list object, so they are taken out of its overhead and counted like the other slots.
+template<typename T, typename Policy>
+MemoryUsage FrankensteinList<T, Policy>::memory_usage() const {
+    StorageFootprint footprint = nodes.footprint(size);
+    MemoryUsage usage;
+    usage.nodes = size;
+    usage.valueBytes = size * sizeof(T);
+    usage.linkBytes = size * (sizeof(NodeType) - sizeof(T));
+    usage.freeBytes = (footprint.handedOut - size) * sizeof(NodeType);
+    usage.slackBytes = (footprint.slots - footprint.handedOut) * sizeof(NodeType) + footprint.allocatorBytes;
+    usage.overheadBytes = sizeof(*this) - footprint.inlineBytes + footprint.tableBytes;
+    if constexpr (grouped) {
+        usage.overheadBytes += runs.bytes();
+    }
+    if constexpr (indexed) {
+        usage.overheadBytes += frankenstein_index::tableBytes<T, link_type>(hashIndex);
+    }
+    return usage;
+}
+
+// The fingerprint, recomputed by a walk when it is stale or the policy keeps none
+template<typename T, typename Policy>
+frankenstein_fingerprint::Fingerprint FrankensteinList<T, Policy>::currentFingerprint() const {
+    if constexpr (fingerprinted) {
+        if(!fingerprint.stale) return fingerprint;
+    }
+    frankenstein_fingerprint::Fingerprint computed;
+    walk(IteratorType::head, [&computed](link_type, const NodeType* node) {
+        computed.append(node->val);
+        return true;
+    });
+    if constexpr (fingerprinted) {
+        fingerprint = computed;
+    }
+    return computed;
+}
+
+// Hash of the values in insertion order
+template<typename T, typename Policy>
+std::uint64_t FrankensteinList<T, Policy>::sequenceHash() const {
+    return currentFingerprint().forward;
+}
+
+// Hash of the values regardless of their order
+template<typename T, typename Policy>
+std::uint64_t FrankensteinList<T, Policy>::multisetHash() const {
+    return currentFingerprint().elements;
+}
+
+// Recompute the fingerprint after values were changed through references, iterators or node pointers
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::refreshFingerprint() {
+    if constexpr (fingerprinted) {
+        fingerprint.stale = true;
+    }
+}
+
+// Check whether two lists hold the same values in any order: equal multiset hashes, then equal sorted chains
+template<typename T, typename Policy>
+bool FrankensteinList<T, Policy>::sameElements(const FrankensteinList &oth) const {
+    if(size != oth.size) return false;
+    if constexpr (fingerprinted) {
+        if(multisetHash() != oth.multisetHash()) return false;
+    }
+
+    ConstIterator mine = cbegin(IteratorType::asc_head);
+    ConstIterator theirs = oth.cbegin(IteratorType::asc_head);
+    for(; mine != cend(); ++mine, ++theirs) {
+        if(!(*mine == *theirs)) return false;
+    }
+    return true;
+}
+
+// Snapshot header: magic, format version, byte order marker, value and position widths, value count
+namespace frankenstein_snapshot {
+    constexpr char magic[8] = {'F', 'R', 'K', 'L', 'I', 'S', 'T', '\0'};
+    constexpr std::uint32_t version = 1;
+    constexpr std::uint32_t byteOrder = 0x01020304;
+    constexpr std::size_t chunkBytes = 1 << 16;// Buffer size of the raw value and position sections
+}
+
+// Write the list in the versioned snapshot format
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::save(std::ostream &os) const {
+    Timer timer(TimedOp::save, this);
+    namespace snap = frankenstein_snapshot;
+    constexpr bool raw = std::is_trivially_copyable<T>::value;
+    const std::uint32_t valueBytes = raw ? sizeof(T) : 0;// 0: values go through FrankensteinSerializer<T>
+    const std::uint32_t indexBytes = (size <= UINT32_MAX) ? 4 : 8;
+    const std::uint64_t count = size;
+
+    os.write(snap::magic, sizeof(snap::magic));
+    os.write(reinterpret_cast<const char*>(&snap::version), sizeof(snap::version));
+    os.write(reinterpret_cast<const char*>(&snap::byteOrder), sizeof(snap::byteOrder));
+    os.write(reinterpret_cast<const char*>(&valueBytes), sizeof(valueBytes));
+    os.write(reinterpret_cast<const char*>(&indexBytes), sizeof(indexBytes));
+    os.write(reinterpret_cast<const char*>(&count), sizeof(count));
+
+    std::vector<char> buffer;
+    buffer.reserve(snap::chunkBytes);
+    auto put = [&](const void* data, std::size_t bytes) {
+        if(buffer.size() + bytes > snap::chunkBytes) {
+            os.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+        const char* first = static_cast<const char*>(data);
+        buffer.insert(buffer.end(), first, first + bytes);
+    };
+    auto flush = [&]() {
+        os.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    };
+
+    // Values in insertion order, remembering the position of every node
+    std::vector<std::pair<link_type, std::uint64_t>> positions;
+    positions.reserve(size);
+    walk(IteratorType::head, [&](link_type link, const NodeType* node) {
+        positions.emplace_back(link, positions.size());
+        if constexpr (raw) {
+            put(&node->val, sizeof(T));
+        } else {
+            FrankensteinSerializer<T>::write(os, node->val);
+        }
+        return true;
+    });
+    flush();
+
+    // The ascending order as positions into the values
+    std::less<link_type> before;
+    std::sort(positions.begin(), positions.end(), [&](const auto& a, const auto& b) {
+        return before(a.first, b.first);
+    });
+    walk(IteratorType::asc_head, [&](link_type link, const NodeType*) {
+        auto found = std::lower_bound(positions.begin(), positions.end(), link, [&](const auto& entry, link_type key) {
+            return before(entry.first, key);
+        });
+        if(indexBytes == 4) {
+            std::uint32_t position = static_cast<std::uint32_t>(found->second);
+            put(&position, sizeof(position));
+        } else {
+            put(&found->second, sizeof(found->second));
+        }
+        return true;
+    });
+    flush();
+
+    if(!os) {
+        throw std::runtime_error("Failed to write list snapshot.");
+    }
+}
+
+// Write one value as snapshots store it: raw bytes or through FrankensteinSerializer<T>
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::writeValue(std::ostream &os, const T &val) {
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        os.write(reinterpret_cast<const char*>(&val), sizeof(T));
+    } else {
+        FrankensteinSerializer<T>::write(os, val);
+    }
+}
+
+// Read one value as snapshots store it
+template<typename T, typename Policy>
+T FrankensteinList<T, Policy>::readValue(std::istream &is) {
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type slot;
+        if(!is.read(reinterpret_cast<char*>(&slot), sizeof(T))) {
+            throw std::runtime_error("Truncated value in list snapshot.");
+        }
+        return *std::launder(reinterpret_cast<const T*>(&slot));
+    } else {
+        return FrankensteinSerializer<T>::read(is);
+    }
+}
+
+// Parse a snapshot: Value(T&&) for every value in insertion order, then Order(position)
+// along the ascending order. Every position is checked to appear exactly once.
+template<typename T, typename Policy>
+template<typename Value, typename Order>
+void FrankensteinList<T, Policy>::readSnapshot(std::istream &is, Value &&value, Order &&order) {
+    namespace snap = frankenstein_snapshot;
+    constexpr bool raw = std::is_trivially_copyable<T>::value;
+    auto get = [&is](void* data, std::size_t bytes) {
+        if(!is.read(static_cast<char*>(data), static_cast<std::streamsize>(bytes))) {
+            throw std::runtime_error("Truncated list snapshot.");
+        }
+    };
+
+    char magic[sizeof(snap::magic)];
+    std::uint32_t version, byteOrder, valueBytes, indexBytes;
+    std::uint64_t count;
+    get(magic, sizeof(magic));
+    get(&version, sizeof(version));
+    get(&byteOrder, sizeof(byteOrder));
+    get(&valueBytes, sizeof(valueBytes));
+    get(&indexBytes, sizeof(indexBytes));
+    get(&count, sizeof(count));
+    if(std::memcmp(magic, snap::magic, sizeof(magic)) != 0) {
+        throw std::runtime_error("Not a list snapshot.");
+    }
+    if(version != snap::version || byteOrder != snap::byteOrder) {
+        throw std::runtime_error("Unsupported list snapshot version or byte order.");
+    }
+    if(valueBytes != (raw ? sizeof(T) : 0) || (indexBytes != 4 && indexBytes != 8)) {
+        throw std::runtime_error("List snapshot does not match the value type.");
+    }
 
-    // Handle asc_head (ascending order)
-    if (!asc_head || node->val < asc_head->val) {
-        node->greater = asc_head;
-        asc_head = node;
+    if constexpr (raw) {
+        using Slot = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+        std::vector<Slot> chunk(std::max<std::size_t>(snap::chunkBytes / sizeof(T), 1));
+        for(std::uint64_t left = count; left; ) {
+            std::size_t part = static_cast<std::size_t>(std::min<std::uint64_t>(left, chunk.size()));
+            get(chunk.data(), part * sizeof(T));
+            for(std::size_t i = 0; i < part; ++i) {
+                value(T(*std::launder(reinterpret_cast<const T*>(&chunk[i]))));
+            }
+            left -= part;
+        }
     } else {
-        Node<T>* curr = asc_head;
-        while (curr->greater && curr->greater->val < node->val) {
-            curr = curr->greater;
+        for(std::uint64_t i = 0; i < count; ++i) {
+            value(FrankensteinSerializer<T>::read(is));
         }
-        node->greater = curr->greater;
-        curr->greater = node;
     }
 
-    // Handle desc_head (descending order)
-    if (!desc_head || node->val > desc_head->val) {
-        node->lesser = desc_head;
-        desc_head = node;
-    } else {
-        Node<T>* curr = desc_head;
-        while (curr->lesser && curr->lesser->val > node->val) {
-            curr = curr->lesser;
+    // All values were read, so count is backed by data
+    std::vector<bool> seen(static_cast<std::size_t>(count));
+    for(std::uint64_t i = 0; i < count; ++i) {
+        std::uint64_t position = 0;
+        if(indexBytes == 4) {
+            std::uint32_t narrow;
+            get(&narrow, sizeof(narrow));
+            position = narrow;
+        } else {
+            get(&position, sizeof(position));
+        }
+        if(position >= count || seen[position]) {
+            throw std::runtime_error("Corrupt sorted order in list snapshot.");
         }
-        node->lesser = curr->lesser;
-        curr->lesser = node;
+        seen[position] = true;
+        order(position);
     }
 }
 
-// Get a pointer to the node at a specified position
-template<typename T>
-Node<T>* FrankensteinList<T>::getNodeAt(std::size_t pos) {
-    if(pos < 0|| pos >= size) {
-        throw std::out_of_range("Position is out of range.");
-    }
-
-    std::size_t count = 0;
-    Node<T>* curr = head;
-    while(count != pos) {
-        curr = curr->next;
-        ++count;
+// Replace the contents with a snapshot. The nodes are allocated in insertion order and
+// both chains are linked from the stored orders, no value is compared.
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::load(std::istream &is) {
+    Timer timer(TimedOp::load, this);
+    // Build aside so that a bad snapshot leaves this list untouched
+    FrankensteinList loaded(getMemoryResource());
+    std::vector<link_type> byPosition;
+    std::vector<link_type> ascending;
+    readSnapshot(is, [&](T &&val) {
+        link_type link = loaded.createNode(std::move(val));
+        loaded.appendUnsorted(link);
+        byPosition.push_back(link);
+    }, [&](std::uint64_t position) {
+        ascending.push_back(byPosition[position]);
+    });
+    loaded.linkSortedChain(ascending);
+
+    JournalGuard guard(*this, JournalOp::replace, loaded);
+    swap(loaded);
+    journal.swap(loaded.journal);// The journal stays with this list
+}
+
+// Write a record argument: a value, a 64-bit position or count, or a list as a snapshot
+template<typename T, typename Policy>
+template<typename Arg>
+void FrankensteinList<T, Policy>::journalArg(std::ostream &os, const Arg &arg) {
+    if constexpr (std::is_same<Arg, T>::value) {
+        writeValue(os, arg);
+    } else if constexpr (std::is_same<Arg, FrankensteinList>::value) {
+        arg.save(os);
+    } else {
+        static_assert(std::is_same<Arg, std::uint64_t>::value, "Journal positions and counts are 64-bit");
+        os.write(reinterpret_cast<const char*>(&arg), sizeof(arg));
     }
-    return curr;
 }
 
-// Insert an element at the front
-template<typename T>
-void FrankensteinList<T>::push_front(const T &val) {
-    Node<T>* node = new Node(val);
-    if(head) {
-        head->prev = node;
-    } else {
-        tail = node;
+// Write the record of a mutating member unless a member is already in progress
+template<typename T, typename Policy>
+template<typename... Args>
+FrankensteinList<T, Policy>::JournalGuard::JournalGuard(const FrankensteinList &list, JournalOp op, const Args&... args)
+        :journal(list.journal.get())
+{
+    if(!journal) return;
+    if(journal->depth == 0) {
+        std::ostream& os = journal->log;
+        os.put(static_cast<char>(op));
+        (journalArg(os, args), ...);
+        if(!os) {
+            throw std::runtime_error("Failed to write list journal.");
+        }
+    }
+    ++journal->depth;
+}
+
+// Leave the member
+template<typename T, typename Policy>
+FrankensteinList<T, Policy>::JournalGuard::~JournalGuard() {
+    if(journal) --journal->depth;
+}
+
+// Values and sorted ranks a log is replayed on. Records are applied to the values alone and
+// the nodes are built once at the end, so the sorted chain is linked by one sort instead of
+// one insertion per record. A rank orders a value among the values equal to it the way
+// PutInSortedOrder does: a new value goes in front of them.
+template<typename T, typename Policy>
+class FrankensteinList<T, Policy>::Replay {
+public:
+    // Replace the values with a snapshot, ranking them along its ascending order
+    void snapshot(std::istream &is) {
+        std::deque<Entry> read;
+        std::int64_t rank = 0;
+        readSnapshot(is, [&](T &&val) {
+            read.push_back(Entry{std::move(val), 0});
+        }, [&](std::uint64_t position) {
+            read[position].rank = rank++;
+        });
+        values.swap(read);
+        low = 0;
     }
-    node->next = head;
-    head = node;
-    ++size;
-    PutInSortedOrder(node);
-}
 
-// Remove the element from the front
-template<typename T>
-void FrankensteinList<T>::pop_front() {
-    if (!head) {
-        throw std::runtime_error("List is empty. Cannot pop_front.");
+    // Apply the records of a log, returning the offset after the last complete one.
+    // A record cut short by the end of the log was never completed and is ignored.
+    std::uint64_t run(std::istream &is) {
+        for(;;) {
+            std::streamoff start = is.tellg();
+            int tag = is.get();
+            if(tag == std::char_traits<char>::eof()) {
+                return static_cast<std::uint64_t>(start);
+            }
+            try {
+                apply(static_cast<JournalOp>(tag), is);
+            } catch(const std::runtime_error&) {
+                if(is.eof()) {
+                    return static_cast<std::uint64_t>(start);
+                }
+                throw;
+            }
+        }
     }
 
-    if(head == tail) {
-        // Only one element in the list
-        delete head;
-        head = nullptr;
-        tail = nullptr;
-        asc_head = nullptr;
-        desc_head = nullptr;
-        size = 0;
-    } else {
-        Node<T>* tmp = head;
-        if(tmp == asc_head) {
-            tmp->greater->lesser = tmp->lesser;
-            asc_head = asc_head->greater;
-        } else if(tmp == desc_head) {
-            tmp->lesser->greater = tmp->greater;
-            desc_head = desc_head->lesser;
-        } else {
-            tmp->greater->lesser = tmp->lesser;
-            tmp->lesser->greater = tmp->greater;
+    // Allocate the nodes in insertion order, then link the sorted chain by rank
+    void build(FrankensteinList &list) {
+        std::vector<std::pair<std::int64_t, link_type>> ranked;
+        ranked.reserve(values.size());
+        while(!values.empty()) {
+            link_type link = list.createNode(std::move(values.front().val));
+            list.appendUnsorted(link);
+            ranked.emplace_back(values.front().rank, link);
+            values.pop_front();
+        }
+        std::sort(ranked.begin(), ranked.end(), [&list](const auto& a, const auto& b) {
+            const T& x = list.at(a.second)->val;
+            const T& y = list.at(b.second)->val;
+            return x < y || (!(y < x) && a.first < b.first);
+        });
+        std::vector<link_type> ascending;
+        ascending.reserve(ranked.size());
+        for(const auto& entry : ranked) {
+            ascending.push_back(entry.second);
         }
-        head = head->next;
-        head->prev = nullptr;
-        delete tmp;
+        list.linkSortedChain(ascending);
+    }
+private:
+    struct Entry {
+        T val;
+        std::int64_t rank;// Order among equal values in the sorted chain
+    };
+
+    // Sorted chain order
+    static bool before(const Entry &a, const Entry &b) {
+        return a.val < b.val || (!(b.val < a.val) && a.rank < b.rank);
     }
-    --size;
-}
 
-// Get a reference to the front element
-template<typename T>
-T& FrankensteinList<T>::front() {
-    if(!head) {
-        throw std::runtime_error("List is empty. Cannot access front element.");
+    static std::uint64_t number(std::istream &is) {
+        std::uint64_t n;
+        if(!is.read(reinterpret_cast<char*>(&n), sizeof(n))) {
+            throw std::runtime_error("Truncated list journal record.");
+        }
+        return n;
     }
-    return head->val;
-}
 
-// Insert an element at the back
-template<typename T>
-void FrankensteinList<T>::push_back(const T &val) {
-    Node<T>* node = new Node(val);
-    if(!head) {
-        head = node;
-        tail = node;
-    } else {
-        tail->next = node;
-        node->prev = tail;
-        tail = node;
+    static std::vector<T> list(std::istream &is) {
+        std::vector<T> read;
+        readSnapshot(is, [&](T &&val) { read.push_back(std::move(val)); }, [](std::uint64_t) {});
+        return read;
     }
-    ++size;
-    PutInSortedOrder(node);
-}
 
-// Remove the element from the back
-template<typename T>
-void FrankensteinList<T>::pop_back() {
-    if (!tail) {
-        throw std::runtime_error("List is empty. Cannot pop_back.");
+    // The values of a list argument in the order of its sorted chain
+    static std::vector<T> sortedList(std::istream &is) {
+        std::vector<T> read;
+        std::vector<T> ascending;
+        readSnapshot(is, [&](T &&val) { read.push_back(std::move(val)); }, [&](std::uint64_t position) {
+            ascending.push_back(std::move(read[position]));
+        });
+        return ascending;
     }
 
-    if (tail == head) {
-        // Only one element in the list
-        delete tail;
-        head = nullptr;
-        tail = nullptr;
-        asc_head = nullptr;
-        desc_head = nullptr;
-        size = 0;
-    } else {
-        Node<T>* tmp = tail;
-        if(tmp == desc_head) {
-            tmp->lesser->greater = tmp->greater;
-            desc_head = desc_head->lesser;
-        } else if(tmp == asc_head) {
-            tmp->greater->lesser = tmp->lesser;
-            asc_head = asc_head->greater;
+    // The value resize() and emplace_front() add
+    static T zero() {
+        if constexpr (std::is_convertible<int, T>::value) {
+            return 0;
         } else {
-            tmp->lesser->greater = tmp->greater;
-            tmp->greater->lesser = tmp->lesser;
+            throw std::runtime_error("Corrupt list journal.");
         }
-        tail = tail->prev;
-        tail->next = nullptr;
-        delete tmp;
     }
-    --size;
-}
 
-// Get a reference to the back element
-template<typename T>
-T& FrankensteinList<T>::back() {
-    if(!tail) {
-        throw std::runtime_error("List is empty. Cannot access back element.");
+    static void check(bool valid) {
+        if(!valid) {
+            throw std::runtime_error("Corrupt list journal.");
+        }
     }
-    return tail->val;
-}
-
-// Check if the list is empty
-template<typename T>
-bool FrankensteinList<T>::empty() const {
-    return size == 0;
-}
 
-// Reverse the order of elements in the list
-template<typename T>
-void FrankensteinList<T>::reverse() {
-    // If the list is empty or has only one element, no need to reverse
-    if(size <= 1) return;
+    void insert(std::size_t pos, T val) {
+        values.insert(values.begin() + static_cast<std::ptrdiff_t>(pos), Entry{std::move(val), --low});
+    }
 
-    Node<T>* curr = head;
-    Node<T>* tmp;
+    void erase(std::size_t first, std::size_t count) {
+        auto from = values.begin() + static_cast<std::ptrdiff_t>(first);
+        auto to = from + static_cast<std::ptrdiff_t>(count);
+        values.erase(from, to);
+    }
 
-    // Traverse the list and reverse the links between nodes
-    while(curr) {
-        tmp = curr->next;
-        curr->next = curr->prev;
-        curr->prev = curr->next;
-        curr = tmp;
+    // Drop the flagged values, keeping the order of the rest
+    void sweep(const std::vector<bool> &doomed) {
+        std::deque<Entry> kept;
+        for(std::size_t i = 0; i < values.size(); ++i) {
+            if(!doomed[i]) kept.push_back(std::move(values[i]));
+        }
+        values.swap(kept);
     }
 
-    // Swap the head and tail pointers
-    std::swap(head, tail);
-}
+    void clear() {
+        values.clear();
+    }
 
-// Function to remove duplicate elements in the list
-template<typename T>
-void FrankensteinList<T>::unique() {
-    if(!asc_head) return;// If the list is empty or already sorted, return
-
-    Node<T>* curr = asc_head;
-    Node<T>* prev = nullptr;
-
-    while(curr) {
-        Node<T>* next = curr->greater;
-
-        // Check if the current node has the same value as the next node
-        if(next && curr->val == next->val) {
-            if(prev) {
-                prev->greater = next;// Connect the previous node to the next node
-                if(next->greater) {
-                    next->greater->lesser = curr;
-                }
-                if(curr == head) {
-                    head = head->next;
-                }
-                if(curr == tail) {
-                    tail = tail->prev;
-                } else if (curr->prev && curr->next) {
-                    curr->prev->next = curr->next;
-                    curr->next->prev = curr->prev;
-                }
-                delete curr;// Delete the current node
+    // What combineWith() does: pair the values off along the sorted order, keep the named parts and
+    // append the values taken from the other list. The sorted order becomes the lockstep order.
+    void combine(std::vector<T> &&other, unsigned keep) {
+        std::size_t n = values.size();
+        std::vector<std::size_t> order(n);
+        for(std::size_t i = 0; i < n; ++i) order[i] = i;
+        std::sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) {
+            return before(values[a], values[b]);
+        });
+
+        std::vector<bool> doomed(n);
+        std::vector<Entry> taken;
+        std::int64_t rank = 0;
+        std::size_t i = 0;
+        std::size_t j = 0;
+        while(i < n || j < other.size()) {
+            if(j == other.size() || (i < n && values[order[i]].val < other[j])) {
+                doomed[order[i]] = !(keep & onlyFirst);
+                if(keep & onlyFirst) values[order[i]].rank = rank++;
+                ++i;
+            } else if(i == n || other[j] < values[order[i]].val) {
+                if(keep & onlySecond) taken.push_back(Entry{std::move(other[j]), rank++});
+                ++j;
             } else {
-                asc_head = next;
-                next->lesser = nullptr;
-                if(curr == head) {
-                    head = head->next;
-                }
-                if(curr == tail) {
-                    tail = tail->prev;
-                } else if (curr->prev && curr->next) {
-                    curr->prev->next = curr->next;
-                    curr->next->prev = curr->prev;
-                }
-                delete curr;// Delete the current node
+                doomed[order[i]] = !(keep & inBoth);
+                if(keep & inBoth) values[order[i]].rank = rank++;
+                ++i;
+                ++j;
             }
-            curr = next;
-            --size;
-        } else {
-            prev = curr;
-            curr = next;
         }
+        sweep(doomed);
+        for(Entry& entry : taken) values.push_back(std::move(entry));
+        low = 0;
     }
-}
-
-
-// Function to merge another list into this list
-template<typename T>
-void FrankensteinList<T>::merge(const FrankensteinList<T> &oth) {
-    while(oth.head) {
-        Node<T>* next = oth.head->next;
-        push_back(oth.head->val);
-        delete oth.head;
-        oth.head = next;
-    }
-    oth.head = nullptr;
-    oth.tail = nullptr;
-    oth.asc_head = nullptr;
-    oth.desc_head = nullptr;
-    oth.size = 0;
-}
 
-// Function to remove all occurrences of a value from the list
-template<typename T>
-void FrankensteinList<T>::remove(const T &val) {
-    Node<T>* curr = asc_head;
-    Node<T>* prev = nullptr;
-
-    while(curr) {
-        if(curr->val == val) {
-            Node<T>* next = curr->greater;
-            if(prev) {
-                prev->greater = next;
-                if(next) {
-                    next->lesser = prev;
-                }
-                if(curr == head) {
-                    head = head->next;
-                } else if(curr == tail) {
-                    tail = tail->prev;
-                } else {
-                    curr->prev->next = curr->next;
-                    curr->next->prev = curr->prev;
+    // One record, read completely before anything changes
+    void apply(JournalOp op, std::istream &is) {
+        std::size_t n = values.size();
+        switch(op) {
+            case JournalOp::push_back: {
+                T val = readValue(is);
+                insert(n, std::move(val));
+                break;
+            }
+            case JournalOp::push_front: {
+                T val = readValue(is);
+                insert(0, std::move(val));
+                break;
+            }
+            case JournalOp::insertAt: {
+                T val = readValue(is);
+                std::uint64_t pos = number(is);
+                check(pos <= n);
+                insert(static_cast<std::size_t>(pos), std::move(val));
+                break;
+            }
+            case JournalOp::pop_front:
+                check(n > 0);
+                erase(0, 1);
+                break;
+            case JournalOp::pop_back:
+                check(n > 0);
+                erase(n - 1, 1);
+                break;
+            case JournalOp::erase: {
+                std::uint64_t pos = number(is);
+                check(pos < n);
+                erase(static_cast<std::size_t>(pos), 1);
+                break;
+            }
+            case JournalOp::eraseRange: {
+                std::uint64_t pos = number(is);
+                std::uint64_t count = number(is);
+                check(pos <= n && count <= n - pos);
+                erase(static_cast<std::size_t>(pos), static_cast<std::size_t>(count));
+                break;
+            }
+            case JournalOp::remove: {
+                // remove() stops at the first larger value of the sorted chain
+                T val = readValue(is);
+                const Entry* stop = nullptr;
+                for(const Entry& e : values) {
+                    if(!(e.val == val) && val < e.val && (!stop || before(e, *stop))) stop = &e;
                 }
-                delete curr;
-                curr = next;
-                --size;
-            } else {
-                asc_head = next;
-                if(next) {
-                    next->lesser = nullptr;
+                std::vector<bool> doomed(n);
+                for(std::size_t i = 0; i < n; ++i) {
+                    doomed[i] = values[i].val == val && (!stop || before(values[i], *stop));
                 }
-                if(curr == head) {
-                    head = head->next;
-                } else if(curr == tail) {
-                    tail = tail->prev;
-                } else {
-                    curr->prev->next = curr->next;
-                    curr->next->prev = curr->prev;
+                sweep(doomed);
+                break;
+            }
+            case JournalOp::unique: {
+                // unique() drops every value equal to its successor in the sorted chain
+                std::vector<std::size_t> order(n);
+                for(std::size_t i = 0; i < n; ++i) order[i] = i;
+                std::sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) {
+                    return before(values[a], values[b]);
+                });
+                std::vector<bool> doomed(n);
+                for(std::size_t i = 0; i + 1 < n; ++i) {
+                    doomed[order[i]] = values[order[i]].val == values[order[i + 1]].val;
                 }
-                delete curr;
-                curr = next;
-                --size;
+                sweep(doomed);
+                break;
             }
-        } else {
-            prev = curr;
-            curr = curr->greater;
+            case JournalOp::reverse:
+                std::reverse(values.begin(), values.end());
+                break;
+            case JournalOp::sort:
+                std::sort(values.begin(), values.end(), before);
+                break;
+            case JournalOp::resize: {
+                std::uint64_t count = number(is);
+                if(count < n) erase(static_cast<std::size_t>(count), n - static_cast<std::size_t>(count));
+                while(values.size() < count) insert(values.size(), zero());
+                break;
+            }
+            case JournalOp::emplace_front: {
+                std::uint64_t count = number(is);
+                if(count < n) erase(0, n - static_cast<std::size_t>(count));
+                while(values.size() < count) insert(0, zero());
+                break;
+            }
+            case JournalOp::splice: {
+                std::uint64_t pos = number(is);
+                std::vector<T> other = list(is);
+                check(pos <= n || other.empty());
+                for(T& val : other) insert(static_cast<std::size_t>(pos), std::move(val));
+                break;
+            }
+            case JournalOp::assign: {
+                T val = readValue(is);
+                std::uint64_t count = number(is);
+                clear();
+                while(values.size() < count) insert(values.size(), val);
+                break;
+            }
+            case JournalOp::merge: {
+                std::vector<T> other = list(is);
+                for(T& val : other) insert(values.size(), std::move(val));
+                break;
+            }
+            case JournalOp::clear:
+                clear();
+                break;
+            case JournalOp::replace: {
+                Replay replaced;
+                replaced.snapshot(is);
+                *this = std::move(replaced);
+                break;
+            }
+            case JournalOp::setUnion:
+                combine(sortedList(is), onlyFirst | onlySecond | inBoth);
+                break;
+            case JournalOp::setIntersection:
+                combine(sortedList(is), inBoth);
+                break;
+            case JournalOp::setDifference:
+                combine(sortedList(is), onlyFirst);
+                break;
+            case JournalOp::setSymmetricDifference:
+                combine(sortedList(is), onlyFirst | onlySecond);
+                break;
+            default:
+                throw std::runtime_error("Corrupt list journal.");
         }
     }
-}
 
-// Function to erase an element at a specific position
-template<typename T>
-void FrankensteinList<T>::erase(const T &pos) {
-    if(pos < 0 || pos >= size) {
-        throw std::out_of_range("Position is out of range.");
-    }
-    if(pos == 0) {
-        pop_front();// Remove the first element
-        return;
-    } else if(pos == size - 1) {
-        pop_back();// Remove the last element
-    } else {
-        Node<T> *curr = getNodeAt(pos);
-        curr->next->prev = curr->prev;
-        curr->prev->next = curr->next;
-        curr->greater->lesser = curr->lesser;
-        curr->lesser->greater = curr->greater;
-        delete curr;// Delete the node at the specified position
-        --size;
+    std::deque<Entry> values;// Values in insertion order
+    std::int64_t low = 0;// Rank of the last value put in front of its equals
+};
+
+// Checkpoint the list to a path and log its changes to path.log. A log left there by
+// an earlier journal is removed first, it must not meet the new checkpoint.
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::startJournal(const std::string &path) {
+    auto started = std::make_unique<frankenstein_journal::Journal>();
+    started->path = path;
+    std::filesystem::remove(started->logPath());
+    journal = std::move(started);
+    try {
+        checkpoint();
+    } catch(...) {
+        journal.reset();
+        throw;
     }
 }
 
-// Function to erase a range of elements starting from a specific position
-template<typename T>
-void FrankensteinList<T>::erase(const T &pos, std::size_t count) {
-    if(pos < 0 || pos > size || pos + count > size) {
-        throw std::out_of_range("Position is out of range.");
+// Write a full snapshot and start an empty log. The snapshot is staged and renamed over
+// the checkpoint, so a crash leaves either the old checkpoint and its log or the new
+// checkpoint, whose generation the old log no longer matches.
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::checkpoint() {
+    namespace jrn = frankenstein_journal;
+    if(!journal) {
+        throw std::logic_error("List has no journal to checkpoint.");
     }
-    if(count == 0) return;
-
-    if(pos == 0) {
-        while(count) {
-            pop_front();// Remove elements from the front
-            --count;
-            --size;
-        }
-    } else if(pos + count == size) {
-        while(count) {
-            pop_back();// Remove elements from the back
-            --count;
-            --size;
+    std::uint64_t generation = journal->generation + 1;
+    std::string staged = journal->path + ".tmp";
+    {
+        std::ofstream os(staged, std::ios::binary | std::ios::trunc);
+        jrn::writeHeader(os, jrn::checkpointMagic, generation);
+        save(os);
+        os.close();
+        if(!os) {
+            throw std::runtime_error("Failed to write list checkpoint " + staged);
         }
-    } else {
-        Node<T>* start = getNodeAt(pos);
-        Node<T>* end = getNodeAt(pos + count - 1);
-
-        start->prev->next = end->next;
-        end->next->prev = start->prev;
-
-        Node<T>* curr = start;
-        while(curr != end->next) {
-            Node<T>* next = curr->greater;
-            curr->greater->lesser = curr->lesser;
-            curr->lesser->greater = curr->greater;
-            delete curr;// Delete nodes in the specified range
-            curr = next;
-            --size;
+    }
+    std::filesystem::rename(staged, journal->path);
+    journal->generation = generation;
+
+    journal->log.close();
+    journal->log.clear();
+    journal->log.open(journal->logPath(), std::ios::binary | std::ios::trunc);
+    jrn::writeHeader(journal->log, jrn::logMagic, generation);
+    flushJournal();
+}
+
+// Replace the contents with a checkpoint plus its log, then keep journaling there.
+// Throws and leaves the list unchanged when the files are missing or corrupt.
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::recover(const std::string &path) {
+    namespace jrn = frankenstein_journal;
+    auto recovered = std::make_unique<jrn::Journal>();
+    recovered->path = path;
+    std::ifstream checkpointFile(path, std::ios::binary);
+    if(!checkpointFile) {
+        throw std::runtime_error("Cannot open list checkpoint " + path);
+    }
+    recovered->generation = jrn::readHeader(checkpointFile, jrn::checkpointMagic);
+
+    // A missing, torn or older log holds nothing the checkpoint lacks
+    std::ifstream logFile(recovered->logPath(), std::ios::binary);
+    bool current = false;
+    if(logFile) {
+        try {
+            current = jrn::readHeader(logFile, jrn::logMagic) == recovered->generation;
+        } catch(const std::runtime_error&) {
+            current = false;
         }
     }
-}
 
-// Function to sort the list
-template<typename T>
-void FrankensteinList<T>::sort() {
-    if(!head) return;// If the list is empty, return
+    FrankensteinList rebuilt(getMemoryResource());
+    std::uint64_t kept = sizeof(jrn::Header);
+    if(current && logFile.peek() != std::char_traits<char>::eof()) {
+        Replay replay;
+        replay.snapshot(checkpointFile);
+        kept = replay.run(logFile);
+        replay.build(rebuilt);
+    } else {
+        rebuilt.load(checkpointFile);
+    }
+    logFile.close();
 
-    head = asc_head;
-    tail = desc_head;
-    Node<T>* curr = head;
-    while(curr) {
-        curr->next = curr->greater;
-        curr->prev = curr->lesser;
-        curr = curr->next;
+    // Append after the last complete record
+    if(current) {
+        std::filesystem::resize_file(recovered->logPath(), kept);
+        recovered->log.open(recovered->logPath(), std::ios::binary | std::ios::app);
+    } else {
+        recovered->log.open(recovered->logPath(), std::ios::binary | std::ios::trunc);
+        jrn::writeHeader(recovered->log, jrn::logMagic, recovered->generation);
     }
+    if(!recovered->log.flush()) {
+        throw std::runtime_error("Cannot open list journal " + recovered->logPath());
+    }
+
+    swap(rebuilt);
+    journal = std::move(recovered);
 }
 
-template<typename T>
-void FrankensteinList<T>::resize(std::size_t newSize) {
-    if(newSize == size){
-        return;
-    } else if (newSize < size) {
-        int count = size - newSize;
-        while (count) {
-            pop_back();
-            --count;
-        }
-    } else {
-        int count = newSize - size;
-        while (count) {
-            push_back(0); // Default-constructed elements
-            --count;
-        }
+// Write the buffered log records to the file
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::flushJournal() {
+    if(!journal) return;
+    if(!journal->log.flush()) {
+        throw std::runtime_error("Failed to write list journal " + journal->logPath());
     }
-    size = newSize;
 }
 
-template<typename T>
-void FrankensteinList<T>::emplace_front(std::size_t newSize) {
-    if(newSize == size) return;// If 'newSize' is the same as the current size, no action is needed.
-    if(newSize > size) {
-        int count = newSize - size;
-        while(count) {
-            push_front(0);// Add elements with value 0 to the front
-            --count;
-        }
-    } else {
-        int count = size - newSize;
-        while(count) {
-            pop_front();// Remove elements from the front
-            --count;
+// Flush the log and detach the journal
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::stopJournal() {
+    flushJournal();
+    journal.reset();
+}
+
+// Build a list from whitespace-separated numbers. A second thread reads the stream in
+// large blocks and parses it with std::from_chars while this thread allocates and links
+// the nodes in insertion order; the sorted chain is linked in one pass at the end, by a
+// single stable sort or, for strictly ascending input, along the insertion chain.
+template<typename T, typename Policy>
+FrankensteinList<T, Policy> FrankensteinList<T, Policy>::from_stream(std::istream &is, std::pmr::memory_resource *resource) {
+    static_assert(std::is_arithmetic<T>::value, "from_stream parses numbers with std::from_chars");
+    namespace txt = frankenstein_text;
+
+    FrankensteinList list(resource);
+    bool sorted = true;// Whether the input so far is strictly ascending
+    std::vector<std::pair<T, link_type>> keyed;// Every node with its value, collected once the input is out of order
+    txt::BatchChannel<T> channel;
+    std::thread parser([&is, &channel] { txt::produce<T>(is, channel); });
+    try {
+        std::vector<T> batch;
+        while(channel.pop(batch)) {
+            for(const T& val : batch) {
+                bool breaks = sorted && list.tail != null && !(list.at(list.tail)->val < val);
+                link_type link = list.createNode(val);
+                list.appendUnsorted(link);
+                if(breaks) {
+                    sorted = false;
+                    list.walk(IteratorType::head, [&keyed](link_type each, const NodeType* node) {
+                        keyed.emplace_back(node->val, each);
+                        return true;
+                    });
+                } else if(!sorted) {
+                    keyed.emplace_back(val, link);
+                }
+            }
+            channel.recycle(std::move(batch));
         }
+    } catch(...) {
+        channel.cancel();
+        parser.join();
+        throw;
     }
-}
+    parser.join();
 
-template<typename T>
-void FrankensteinList<T>::splice(std::size_t pos, const FrankensteinList<T> &list) {
-    // Iterate through the elements in 'list' using a constant iterator.
-    FrankensteinList<T>::ConstIterator it = list.cbegin();
-    while(it != list.cend()) {
-        // Insert each element from 'list' into the current list at the specified 'pos'.
-        insertAt(*it, pos);
-        // Move to the next element in 'list'.
-        ++it;
+    if(sorted) {
+        list.linkSortedAlongInsertion();
+        return list;
     }
-}
 
-// Assign a specified number of elements with the given value.
-template<typename T>
-void FrankensteinList<T>::assign(std::size_t count, const T& val) {
-    clear();
-    while(count) {
-        push_back(val);
-        --count;
+    // Equal values end up newest first, as if each had been put in front of its equals
+    std::reverse(keyed.begin(), keyed.end());
+    std::stable_sort(keyed.begin(), keyed.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+    std::vector<link_type> ascending;
+    ascending.reserve(keyed.size());
+    for(const auto& entry : keyed) {
+        ascending.push_back(entry.second);
     }
+    keyed = {};
+    list.linkSortedChain(ascending);
+    return list;
 }
 
-// Get a pointer to the head of the list
-template<typename T>
-Node<T>* FrankensteinList<T>::getHead() const {
-    return head;
+// Build a list from a text file of whitespace-separated numbers
+template<typename T, typename Policy>
+FrankensteinList<T, Policy> FrankensteinList<T, Policy>::from_file(const std::string &path, std::pmr::memory_resource *resource) {
+    std::ifstream file(path, std::ios::binary);
+    if(!file) {
+        throw std::runtime_error("Cannot open list input " + path);
+    }
+    return from_stream(file, resource);
 }
 
-// Set a pointer to the head of the list
-template<typename T>
-void FrankensteinList<T>::setHead(Node<T>* h) {
-    head = h;
+// Print the list in ascending order
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::printSortedAscendingOrder() const{
+    Timer timer(TimedOp::print, this);
+    streamValues(std::cout, PrintOrder::ascending);
+    std::cout << '\n';
 }
 
-// Get a pointer to the tail of the list
-template<typename T>
-Node<T>* FrankensteinList<T>::getTail() const {
-    return tail;
+// Print the list in descending order
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::printSortedDescendingOrder() const{
+    Timer timer(TimedOp::print, this);
+    streamValues(std::cout, PrintOrder::descending);
+    std::cout << '\n';
+}
+
+// Visit every value in a print order. Descending follows the lesser links, or the
+// ascending chain backwards when there are none.
+template<typename T, typename Policy>
+template<typename Visit>
+void FrankensteinList<T, Policy>::visitValues(PrintOrder order, Visit &&visit) const {
+    if(order != PrintOrder::descending) {
+        walk((order == PrintOrder::ascending) ? IteratorType::asc_head : IteratorType::head, [&visit](link_type, const NodeType* node) {
+            visit(node->val);
+            return true;
+        });
+    } else if constexpr (Chains::has_lesser) {
+        for(link_type curr = desc_head; curr != null; ) {
+            const NodeType* node = at(curr);
+            visit(node->val);
+            curr = node->lesser;
+            tally(&ListStats::lesserHops);
+        }
+    } else {
+        std::vector<const T*> ascending;
+        ascending.reserve(size);
+        walk(IteratorType::asc_head, [&](link_type, const NodeType* node) {
+            ascending.push_back(&node->val);
+            return true;
+        });
+        for(auto it = ascending.rbegin(); it != ascending.rend(); ++it) {
+            visit(**it);
+        }
+    }
 }
 
-// Set a pointer to the tail of the list
-template<typename T>
-void FrankensteinList<T>::setTail(Node<T> *t) {
-    tail = t;
+// Format the values into the per-thread buffer, handing it to flush whenever it fills up
+template<typename T, typename Policy>
+template<typename Flush>
+void FrankensteinList<T, Policy>::formatValues(PrintOrder order, std::string_view separator, bool trailing, Flush &&flush) const {
+    frankenstein_text::FormatBuffer buffer;
+    bool first = true;
+    visitValues(order, [&](const T& val) {
+        if(!first) {
+            buffer.append(separator);
+        }
+        first = false;
+        buffer.value(val);
+        if(buffer.full()) {
+            flush(buffer.take());
+        }
+    });
+    if(trailing && !first) {
+        buffer.append(separator);
+    }
+    std::string_view rest = buffer.take();
+    if(!rest.empty()) {
+        flush(rest);
+    }
 }
 
-// Get a pointer to the ascending head of the list
-template<typename T>
-Node<T>* FrankensteinList<T>::getAscHead() const {
-    return asc_head;
-}
-// Set a pointer to the ascending head of the list
-template<typename T>
-void FrankensteinList<T>::setAscHead(Node<T> *aH) {
-    asc_head = aH;
+// Write every value followed by a space. Buffered through std::to_chars when that prints
+// what the stream would, otherwise through the stream so that its settings apply.
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::streamValues(std::ostream &os, PrintOrder order) const {
+    if(frankenstein_text::plainStream<T>(os)) {
+        formatValues(order, " ", true, [&os](std::string_view text) {
+            os.write(text.data(), static_cast<std::streamsize>(text.size()));
+        });
+    } else {
+        visitValues(order, [&os](const T& val) {
+            os << val << " ";
+        });
+    }
 }
 
-// Get a pointer to the descending head of the list
-template<typename T>
-Node<T>* FrankensteinList<T>::getDescHead() const {
-    return desc_head;
+// Write the values to a stream with a separator between them
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::print(std::ostream &os, PrintOrder order, std::string_view separator) const {
+    Timer timer(TimedOp::print, this);
+    formatValues(order, separator, false, [&os](std::string_view text) {
+        os.write(text.data(), static_cast<std::streamsize>(text.size()));
+    });
 }
 
-// Set a pointer to the descending head of the list
-template<typename T>
-void FrankensteinList<T>::setDescHead(Node<T> *dH) {
-    desc_head = dH;
+// Write the values as characters to an output iterator, returning it past the last one
+template<typename T, typename Policy>
+template<typename OutputIt>
+OutputIt FrankensteinList<T, Policy>::format_to(OutputIt out, PrintOrder order, std::string_view separator) const {
+    Timer timer(TimedOp::print, this);
+    formatValues(order, separator, false, [&out](std::string_view text) {
+        out = std::copy(text.begin(), text.end(), out);
+    });
+    return out;
 }
 
-// Get the current size of the list
-template<typename T>
-int FrankensteinList<T>::getSize() const {
-    return size;
+// Helper function for clearing the list
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::clear() noexcept {
+    abortCompaction();
+
+    // Nodes without a destructor to run can go all at once when the storage allows it
+    bool dropped = false;
+    if constexpr (std::is_trivially_destructible<NodeType>::value) {
+        dropped = nodes.dropAll();
+    }
+    if(dropped) {
+        tally(&ListStats::frees, size);
+    }
+    link_type cur = dropped ? null : head;
+    while(cur != null) {
+        NodeType* node = at(cur);
+        if constexpr (hint_distance > 0) {
+            Storage::prefetch(&nodes, node->next_hint);
+        }
+        link_type next = node->next;
+        nodes.destroy(cur);
+        tally(&ListStats::frees);
+        cur = next;
+    }
+
+    head = null;
+    tail = null;
+    asc_head = null;
+    desc_head = null;
+    size = 0;
+    if constexpr (fingerprinted) {
+        fingerprint.reset();
+    }
+    if constexpr (grouped) {
+        runs.clear();
+    }
+    if constexpr (indexed) {
+        hashIndex.clear();
+    }
 }
 
-// Get the current size of the list
-template<typename T>
-void FrankensteinList<T>::setSize(int s) {
-    size = s;
+// Overload the output stream operator for printing the list
+template<typename T, typename Policy>
+std::ostream &operator<<(std::ostream &os, const FrankensteinList<T, Policy> &list) {
+    list.streamValues(os, FrankensteinList<T, Policy>::PrintOrder::insertion);
+    os << std::endl;
+    return os;
 }
 
-// Print the list in ascending order
-template<typename T>
-void FrankensteinList<T>::printSortedAscendingOrder() const{
-    Node<T>* curr = asc_head;
-    while(curr) {
-        std::cout << curr->val << " ";
-        curr = curr->greater;
+// Move every node into one contiguous block in traversal order and rewrite all links.
+// Each old node forwards to its copy through its next link, so remapping a link costs one lookup.
+template<typename T, typename Policy>
+void FrankensteinList<T, Policy>::compact(IteratorType order) {
+    Timer timer(TimedOp::compact, this);
+    abortCompaction();
+    if(size == 0) return;
+
+    const bool byInsertion = (order == IteratorType::head);
+    std::vector<link_type> sequence;
+    std::vector<link_type> moved;
+    sequence.reserve(size);
+    moved.reserve(size);
+    Storage target = nodes.compactTarget(size);
+
+    // Copy the nodes with their old links and leave a forwarding link behind
+    try {
+        for(link_type curr = byInsertion ? head : asc_head; curr != null; ) {
+            NodeType* from = at(curr);
+            link_type prev = null;
+            link_type lesser = null;
+            if constexpr (Chains::has_prev) {
+                prev = from->prev;
+            }
+            if constexpr (Chains::has_lesser) {
+                lesser = from->lesser;
+            }
+            link_type copy = target.create(std::move_if_noexcept(from->val), from->next, prev, from->greater, lesser);
+            if constexpr (grouped) {
+                target.get(copy)->run = from->run;
+            }
+            if constexpr (indexed) {
+                target.get(copy)->equal_prev = from->equal_prev;
+                target.get(copy)->equal_next = from->equal_next;
+            }
+            sequence.push_back(curr);
+            moved.push_back(copy);
+
+            link_type following = byInsertion ? from->next : from->greater;
+            from->next = copy;
+            curr = following;
+        }
+    } catch(...) {
+        // The old nodes are untouched apart from the forwarding links
+        for(std::size_t i = 0; i < moved.size(); ++i) {
+            at(sequence[i])->next = target.get(moved[i])->next;
+            target.destroy(moved[i]);
+        }
+        throw;
     }
-    std::cout << std::endl;
-}
 
-// Print the list in descending order
-template<typename T>
-void FrankensteinList<T>::printSortedDescendingOrder() const{
-    Node<T>* curr = desc_head;
-    while(curr) {
-        std::cout << curr->val << " ";
-        curr = curr->lesser;
+    // The compacted chain links to its neighbours in the block, the other chain goes through the forwarding links
+    auto forward = [this](link_type link) {
+        return (link == null) ? null : at(link)->next;
+    };
+    for(std::size_t i = 0; i < moved.size(); ++i) {
+        NodeType* node = target.get(moved[i]);
+        link_type before = (i > 0) ? moved[i - 1] : null;
+        link_type after = (i + 1 < moved.size()) ? moved[i + 1] : null;
+        if(byInsertion) {
+            node->next = after;
+            node->greater = forward(node->greater);
+            if constexpr (Chains::has_prev) {
+                node->prev = before;
+            }
+            if constexpr (Chains::has_lesser) {
+                node->lesser = forward(node->lesser);
+            }
+        } else {
+            node->next = forward(node->next);
+            node->greater = after;
+            if constexpr (Chains::has_prev) {
+                node->prev = forward(node->prev);
+            }
+            if constexpr (Chains::has_lesser) {
+                node->lesser = before;
+            }
+        }
+    }
+    head = forward(head);
+    tail = forward(tail);
+    asc_head = forward(asc_head);
+    if constexpr (Chains::has_lesser) {
+        desc_head = forward(desc_head);
+    }
+    if constexpr (grouped) {
+        runs.remap(forward);
+    }
+    if constexpr (indexed) {
+        for(std::size_t i = 0; i < moved.size(); ++i) {
+            NodeType* node = target.get(moved[i]);
+            node->equal_prev = forward(node->equal_prev);
+            node->equal_next = forward(node->equal_next);
+        }
+        for(auto& entry : hashIndex) {
+            entry.second.first = forward(entry.second.first);
+            entry.second.last = forward(entry.second.last);
+        }
     }
-    std::cout << std::endl;
-}
 
-// Helper function for clearing the list
-template<typename T>
-void FrankensteinList<T>::clear() noexcept {
-    Node<T>* cur = head;
-    while(cur) {
-        Node<T>* next = cur->next;
-        delete cur;
-        cur = next;
+    for(link_type old : sequence) {
+        nodes.destroy(old);
+    }
+    nodes.adopt(std::move(target));
+}
+
+// Move up to 'budget' nodes into the compaction slab, one at a time in traversal order.
+// The list stays fully usable between calls: the slab only takes moved nodes, so nodes
+// inserted meanwhile come from the resource, and those inserted ahead of the cursor are
+// moved when it gets there. Removing nodes restarts the pass.
+template<typename T, typename Policy>
+bool FrankensteinList<T, Policy>::compactStep(IteratorType order, std::size_t budget) {
+    Timer timer(TimedOp::compact, this);
+    static_assert(pointer_links && Chains::has_prev && Chains::has_lesser,
+                  "Incremental compaction needs pointer links and all four chains");
+
+    if(!compacting || compactOrder != order) {
+        abortCompaction();
+        if(size == 0) return true;
+        nodes.openSlab(size);
+        compacting = true;
+        compactOrder = order;
+        compactCursor = (order == IteratorType::head) ? head : asc_head;
     }
 
-    head = nullptr;
-    tail = nullptr;
-    asc_head = nullptr;
-    desc_head = nullptr;
-    size = 0;
-}
+    nodes.resumeSlab();
+    for(; budget && compactCursor != null; --budget) {
+        if(nodes.slabFull()) {
+            // Nodes inserted ahead of the cursor outgrew the slab, the rest go to one more
+            std::size_t rest = 0;
+            for(NodeType* curr = compactCursor; curr != null; curr = (order == IteratorType::head) ? curr->next : curr->greater) {
+                ++rest;
+            }
+            nodes.openSlab(rest);
+        }
+        NodeType* from = compactCursor;
+        NodeType* to;
+        try {
+            to = nodes.create(std::move_if_noexcept(from->val), from->next, from->prev, from->greater, from->lesser);
+        } catch(...) {
+            nodes.pauseSlab();
+            throw;
+        }
+        compactCursor = (order == IteratorType::head) ? from->next : from->greater;
+        if constexpr (grouped) {
+            to->run = from->run;
+            auto& run = runs[to->run];
+            if(run.head == from) run.head = to;
+            if(run.last == from) run.last = to;
+        }
+        if constexpr (indexed) {
+            to->equal_prev = from->equal_prev;
+            to->equal_next = from->equal_next;
+            auto& group = hashIndex.find(to->val)->second;
+            if(to->equal_prev) to->equal_prev->equal_next = to; else group.first = to;
+            if(to->equal_next) to->equal_next->equal_prev = to; else group.last = to;
+        }
 
-// Overload the output stream operator for printing the list
-template<typename T>
-std::ostream &operator<<(std::ostream &os, const FrankensteinList<T> &list) {
-    Node<T>* curr = list.head;
-    while (curr) {
-        os << curr->val << " ";
-        curr = curr->next;
-    }
-    std::cout << std::endl;
-    return os;
+        // Point the neighbours in both chains at the copy
+        if(to->prev) to->prev->next = to; else head = to;
+        if(to->next) to->next->prev = to; else tail = to;
+        if(to->lesser) to->lesser->greater = to; else asc_head = to;
+        if(to->greater) to->greater->lesser = to; else desc_head = to;
+        nodes.destroy(from);
+    }
+
+    if(compactCursor == null) {
+        abortCompaction();
+        return true;
+    }
+    nodes.pauseSlab();
+    return false;
 }
 
 // Iterator constructor
-template<typename T>
-FrankensteinList<T>::Iterator::Iterator(Node<T> *node, IteratorType t)
-    :ptr(node), type(t)
+template<typename T, typename Policy>
+FrankensteinList<T, Policy>::Iterator::Iterator(NodeType *node, IteratorType t, const Storage *s)
+    :ptr(node), type(t), storage(s)
 {
 }
 
 // Dereference operator for Iterator (non-const)
-template<typename T>
-T& FrankensteinList<T>::Iterator::operator*() {
+template<typename T, typename Policy>
+T& FrankensteinList<T, Policy>::Iterator::operator*() {
     if(!ptr){
         throw std::runtime_error("Iterator is not dereferencable.");
     }
@@ -683,8 +2813,8 @@ T& FrankensteinList<T>::Iterator::operator*() {
 }
 
 // Arrow operator for Iterator (non-const)
-template<typename T>
-T* FrankensteinList<T>::Iterator::operator->() {
+template<typename T, typename Policy>
+T* FrankensteinList<T, Policy>::Iterator::operator->() {
     if(!ptr) {
         throw std::runtime_error("Iterator is not dereferencable.");
     }
@@ -692,55 +2822,58 @@ T* FrankensteinList<T>::Iterator::operator->() {
 }
 
 // Prefix increment operator for Iterator
-template<typename T>
-typename FrankensteinList<T>::Iterator& FrankensteinList<T>::Iterator::operator++() {
-    ptr = (type == IteratorType::head) ? ptr->next : ptr->greater;
+template<typename T, typename Policy>
+typename FrankensteinList<T, Policy>::Iterator& FrankensteinList<T, Policy>::Iterator::operator++() {
+    ptr = Storage::resolve(storage, (type == IteratorType::head) ? ptr->next : ptr->greater);
+    if constexpr (hint_distance > 0) {
+        if(ptr) Storage::prefetch(storage, (type == IteratorType::head) ? ptr->next_hint : ptr->greater_hint);
+    }
     return *this;
 }
 
 
 // Postfix increment operator for Iterator
-template<typename T>
-typename FrankensteinList<T>::Iterator FrankensteinList<T>::Iterator::operator++(int) {
-    FrankensteinList<T>::Iterator tmp = *this;
+template<typename T, typename Policy>
+typename FrankensteinList<T, Policy>::Iterator FrankensteinList<T, Policy>::Iterator::operator++(int) {
+    Iterator tmp = *this;
     ++(*this);
     return tmp;
 }
 
 // Equality comparison operator for Iterator
-template<typename T>
-bool FrankensteinList<T>::Iterator::operator==(const FrankensteinList<T>::Iterator &oth){
+template<typename T, typename Policy>
+bool FrankensteinList<T, Policy>::Iterator::operator==(const Iterator &oth){
     return ptr == oth.ptr;
 }
 
 // Inequality comparison operator for Iterator
-template<typename T>
-bool FrankensteinList<T>::Iterator::operator!=(const FrankensteinList::Iterator &oth){
+template<typename T, typename Policy>
+bool FrankensteinList<T, Policy>::Iterator::operator!=(const Iterator &oth){
     return !(ptr == oth.ptr);
 }
 
 // Iterator begin function
-template<typename T>
-typename FrankensteinList<T>::Iterator FrankensteinList<T>::begin(FrankensteinList<T>::IteratorType type) {
-    return Iterator((type == IteratorType::head) ? head : asc_head, type);
+template<typename T, typename Policy>
+typename FrankensteinList<T, Policy>::Iterator FrankensteinList<T, Policy>::begin(IteratorType type) {
+    return Iterator(at((type == IteratorType::head) ? head : asc_head), type, &nodes);
 }
 
 // Iterator end function
-template<typename T>
-typename FrankensteinList<T>::Iterator FrankensteinList<T>::end(FrankensteinList<T>::IteratorType type) {
-    return Iterator(nullptr, IteratorType::head);
+template<typename T, typename Policy>
+typename FrankensteinList<T, Policy>::Iterator FrankensteinList<T, Policy>::end(IteratorType type) {
+    return Iterator(nullptr, type, &nodes);
 }
 
 // ConstIterator constructor
-template<typename T>
-FrankensteinList<T>::ConstIterator::ConstIterator(const Node<T> *node, IteratorType t)
-    :ptr(node), type(t)
+template<typename T, typename Policy>
+FrankensteinList<T, Policy>::ConstIterator::ConstIterator(const NodeType *node, IteratorType t, const Storage *s)
+    :ptr(node), type(t), storage(s)
 {
 }
 
 // Dereference operator for ConstIterator (const)
-template<typename T>
-const T& FrankensteinList<T>::ConstIterator::operator*() const {
+template<typename T, typename Policy>
+const T& FrankensteinList<T, Policy>::ConstIterator::operator*() const {
     if (!ptr) {
         throw std::runtime_error("Iterator is not dereferencable.");
     }
@@ -748,8 +2881,8 @@ const T& FrankensteinList<T>::ConstIterator::operator*() const {
 }
 
 // Arrow operator for ConstIterator (const)
-template<typename T>
-const T* FrankensteinList<T>::ConstIterator::operator->() const {
+template<typename T, typename Policy>
+const T* FrankensteinList<T, Policy>::ConstIterator::operator->() const {
     if (!ptr) {
         throw std::runtime_error("Iterator is not dereferencable.");
     }
@@ -757,182 +2890,171 @@ const T* FrankensteinList<T>::ConstIterator::operator->() const {
 }
 
 // Prefix increment operator for ConstIterator
-template<typename T>
-typename FrankensteinList<T>::ConstIterator &FrankensteinList<T>::ConstIterator::operator++() {
-    ptr = type == IteratorType::head ? ptr->next : ptr->greater;
+template<typename T, typename Policy>
+typename FrankensteinList<T, Policy>::ConstIterator &FrankensteinList<T, Policy>::ConstIterator::operator++() {
+    ptr = Storage::resolve(storage, type == IteratorType::head ? ptr->next : ptr->greater);
+    if constexpr (hint_distance > 0) {
+        if(ptr) Storage::prefetch(storage, (type == IteratorType::head) ? ptr->next_hint : ptr->greater_hint);
+    }
     return *this;
 }
 
 // Postfix increment operator for ConstIterator
-template<typename T>
-typename FrankensteinList<T>::ConstIterator FrankensteinList<T>::ConstIterator::operator++(int) {
-    FrankensteinList<T>::ConstIterator tmp = *this;
+template<typename T, typename Policy>
+typename FrankensteinList<T, Policy>::ConstIterator FrankensteinList<T, Policy>::ConstIterator::operator++(int) {
+    ConstIterator tmp = *this;
     ++(*this);
     return tmp;
 }
 
 // Equality comparison operator for ConstIterator
-template<typename T>
-bool FrankensteinList<T>::ConstIterator::operator==(const FrankensteinList<T>::ConstIterator &oth) const {
+template<typename T, typename Policy>
+bool FrankensteinList<T, Policy>::ConstIterator::operator==(const ConstIterator &oth) const {
     return ptr == oth.ptr;
 }
 
 // Inequality comparison operator for ConstIterator
-template<typename T>
-bool FrankensteinList<T>::ConstIterator::operator!=(const FrankensteinList<T>::ConstIterator &oth) const {
+template<typename T, typename Policy>
+bool FrankensteinList<T, Policy>::ConstIterator::operator!=(const ConstIterator &oth) const {
     return ptr != oth.ptr;
 }
 
 // ConstIterator begin function
-template<typename T>
-typename FrankensteinList<T>::ConstIterator FrankensteinList<T>::cbegin(FrankensteinList<T>::IteratorType type) const {
-    return ConstIterator((type == IteratorType::head) ? head : asc_head, type);
+template<typename T, typename Policy>
+typename FrankensteinList<T, Policy>::ConstIterator FrankensteinList<T, Policy>::cbegin(IteratorType type) const {
+    return ConstIterator(at((type == IteratorType::head) ? head : asc_head), type, &nodes);
 }
 
 // ConstIterator end function
-template<typename T>
-typename FrankensteinList<T>::ConstIterator FrankensteinList<T>::cend(FrankensteinList<T>::IteratorType type) const {
-    return ConstIterator(nullptr, type);
+template<typename T, typename Policy>
+typename FrankensteinList<T, Policy>::ConstIterator FrankensteinList<T, Policy>::cend(IteratorType type) const {
+    return ConstIterator(nullptr, type, &nodes);
 }
 
 // Comparison operators
 // Equality operator
-template<typename T>
-bool operator==(const FrankensteinList<T>& first, const FrankensteinList<T>& second) {
+template<typename T, typename P>
+bool operator==(const FrankensteinList<T, P>& first, const FrankensteinList<T, P>& second) {
     // Compare sizes first
     if(first.getSize() != second.getSize()) return false;
 
+    // Differing fingerprints settle it without a walk, equal ones still need the element check
+    if constexpr (P::Fingerprint::enabled) {
+        if(first.sequenceHash() != second.sequenceHash()) return false;
+    }
+
     // Compare the elements in both lists
-    Node<T>* firstHead = first.getHead();
-    Node<T>* secondHead = second.getHead();
+    auto firstIt = first.cbegin();
+    auto secondIt = second.cbegin();
 
-    while(firstHead && secondHead) {
-        if(firstHead->val != secondHead->val) {
+    while(firstIt != first.cend() && secondIt != second.cend()) {
+        if(*firstIt != *secondIt) {
             return false; // Elements are not equal
         }
-        firstHead = firstHead->next;
-        secondHead = secondHead->next;
+        ++firstIt;
+        ++secondIt;
     }
 
     // If both lists reached the end, they are equal
-    return !firstHead && !secondHead;
+    return firstIt == first.cend() && secondIt == second.cend();
 }
 
 // Inequality operator
-template<typename T>
-bool operator!=(const FrankensteinList<T>& first, const FrankensteinList<T>& second) {
+template<typename T, typename P>
+bool operator!=(const FrankensteinList<T, P>& first, const FrankensteinList<T, P>& second) {
     return !(first == second);
 }
 
 // Less than operator
-template<typename T>
-bool operator<(const FrankensteinList<T>& first, const FrankensteinList<T>& second) {
+template<typename T, typename P>
+bool operator<(const FrankensteinList<T, P>& first, const FrankensteinList<T, P>& second) {
     if(first.getSize() != second.getSize()) return false;
 
-    Node<T>* firstHead = first.getHead();
-    Node<T>* secondHead = second.getHead();
+    auto firstIt = first.cbegin();
+    auto secondIt = second.cbegin();
 
-    while(firstHead && secondHead) {
-        if(firstHead->val >= secondHead->val) {
+    while(firstIt != first.cend() && secondIt != second.cend()) {
+        if(*firstIt >= *secondIt) {
             return false;
         }
-        firstHead = firstHead->next;
-        secondHead = secondHead->next;
+        ++firstIt;
+        ++secondIt;
     }
 
-    return !firstHead && !secondHead;
+    return firstIt == first.cend() && secondIt == second.cend();
 }
 
 // Less than or equal to operator
-template<typename T>
-bool operator<=(const FrankensteinList<T>& first, const FrankensteinList<T>& second){
+template<typename T, typename P>
+bool operator<=(const FrankensteinList<T, P>& first, const FrankensteinList<T, P>& second){
     if(first.getSize() != second.getSize()) return false;
 
-    Node<T>* firstHead = first.getHead();
-    Node<T>* secondHead = second.getHead();
+    auto firstIt = first.cbegin();
+    auto secondIt = second.cbegin();
 
-    while(firstHead && secondHead) {
-        if(firstHead->val > secondHead->val) {
+    while(firstIt != first.cend() && secondIt != second.cend()) {
+        if(*firstIt > *secondIt) {
             return false;
         }
-        firstHead = firstHead->next;
-        secondHead = secondHead->next;
+        ++firstIt;
+        ++secondIt;
     }
 
-    return !firstHead && !secondHead;
+    return firstIt == first.cend() && secondIt == second.cend();
 }
 
 // Greater than operator
-template<typename T>
-bool operator>(const FrankensteinList<T>& first, const FrankensteinList<T>& second){
+template<typename T, typename P>
+bool operator>(const FrankensteinList<T, P>& first, const FrankensteinList<T, P>& second){
     if(first.getSize() != second.getSize()) return false;
 
-    Node<T>* firstHead = first.getHead();
-    Node<T>* secondHead = second.getHead();
+    auto firstIt = first.cbegin();
+    auto secondIt = second.cbegin();
 
-    while(firstHead && secondHead) {
-        if(firstHead->val <= secondHead->val) {
+    while(firstIt != first.cend() && secondIt != second.cend()) {
+        if(*firstIt <= *secondIt) {
             return false;
         }
-        firstHead = firstHead->next;
-        secondHead = secondHead->next;
+        ++firstIt;
+        ++secondIt;
     }
 
-    return !firstHead && !secondHead;
+    return firstIt == first.cend() && secondIt == second.cend();
 }
 
 // Greater than or equal to operator
-template<typename T>
-bool operator>=(const FrankensteinList<T>& first, const FrankensteinList<T>& second){
+template<typename T, typename P>
+bool operator>=(const FrankensteinList<T, P>& first, const FrankensteinList<T, P>& second){
     if(first.getSize() != second.getSize()) return false;
 
-    Node<T>* firstHead = first.getHead();
-    Node<T>* secondHead = second.getHead();
+    auto firstIt = first.cbegin();
+    auto secondIt = second.cbegin();
 
-    while(firstHead && secondHead) {
-        if(firstHead->val < secondHead->val) {
+    while(firstIt != first.cend() && secondIt != second.cend()) {
+        if(*firstIt < *secondIt) {
             return false;
         }
-        firstHead = firstHead->next;
-        secondHead = secondHead->next;
+        ++firstIt;
+        ++secondIt;
     }
 
-    return !firstHead && !secondHead;
+    return firstIt == first.cend() && secondIt == second.cend();
 }
 
-template<typename T>
-void swap(FrankensteinList<T>& first, FrankensteinList<T>& second) {
-    // Swap the members of the first and second objects
-    using std::swap;
-
-    auto* tmpH = first.getHead();
-    first.setHead(second.getHead());
-    second.setHead(tmpH);
-
-    auto* tmpT = first.getTail();
-    first.setTail(second.getTail());
-    second.setTail(tmpT);
-
-    auto* tmpAH = first.getAscHead();
-    first.setAscHead(second.getAscHead());
-    second.setAscHead(tmpAH);
-
-    auto* tmpDH = first.getDescHead();
-    first.setDescHead(second.getDescHead());
-    second.setDescHead(tmpDH);
-
-    int s = first.getSize();
-    first.setSize(second.getSize());
-    second.setSize(s);
+template<typename T, typename P>
+void swap(FrankensteinList<T, P>& first, FrankensteinList<T, P>& second) {
+    // Swap the nodes and the chain heads of the first and second objects
+    first.swap(second);
 }
 
 //merge two list in third list
-template<typename T>
-FrankensteinList<T> merge(const FrankensteinList<T>& first, const FrankensteinList<T>& second) {
-    FrankensteinList<T> mergedList;
+template<typename T, typename P>
+FrankensteinList<T, P> merge(const FrankensteinList<T, P>& first, const FrankensteinList<T, P>& second) {
+    using IteratorType = typename FrankensteinList<T, P>::IteratorType;
+    FrankensteinList<T, P> mergedList;
 
-    typename FrankensteinList<T>::ConstIterator it1 = first.cbegin(FrankensteinList<T>::IteratorType::asc_head);
-    typename FrankensteinList<T>::ConstIterator it2 = second.cbegin(FrankensteinList<T>::IteratorType::asc_head);
+    auto it1 = first.cbegin(IteratorType::asc_head);
+    auto it2 = second.cbegin(IteratorType::asc_head);
 
     while(it1 != first.cend() && it2 != second.cend()) {
         if(*it1 < *it2) {
@@ -956,3 +3078,47 @@ FrankensteinList<T> merge(const FrankensteinList<T>& first, const FrankensteinLi
 
     return mergedList;
 }
+
+//multiset union: every value as often as it occurs in either list
+template<typename T, typename P>
+FrankensteinList<T, P> set_union(const FrankensteinList<T, P>& first, const FrankensteinList<T, P>& second) {
+    using List = FrankensteinList<T, P>;
+    typename List::Timer timer(List::TimedOp::setUnion, &first);
+    return List::combine(first, second, List::onlyFirst | List::onlySecond | List::inBoth);
+}
+
+//multiset intersection: every value as often as it occurs in both lists
+template<typename T, typename P>
+FrankensteinList<T, P> set_intersection(const FrankensteinList<T, P>& first, const FrankensteinList<T, P>& second) {
+    using List = FrankensteinList<T, P>;
+    typename List::Timer timer(List::TimedOp::setIntersection, &first);
+    return List::combine(first, second, List::inBoth);
+}
+
+//multiset difference: the occurrences of the first list without a partner in the second
+template<typename T, typename P>
+FrankensteinList<T, P> set_difference(const FrankensteinList<T, P>& first, const FrankensteinList<T, P>& second) {
+    using List = FrankensteinList<T, P>;
+    typename List::Timer timer(List::TimedOp::setDifference, &first);
+    return List::combine(first, second, List::onlyFirst);
+}
+
+//multiset symmetric difference: the occurrences of either list without a partner in the other
+template<typename T, typename P>
+FrankensteinList<T, P> set_symmetric_difference(const FrankensteinList<T, P>& first, const FrankensteinList<T, P>& second) {
+    using List = FrankensteinList<T, P>;
+    typename List::Timer timer(List::TimedOp::setSymmetricDifference, &first);
+    return List::combine(first, second, List::onlyFirst | List::onlySecond);
+}
+
+//k-way merge of the sorted chains of many lists into a new ascending list, equal values in the order of the lists
+template<typename Range>
+auto merge_all(const Range& lists, unsigned threads) {
+    using List = std::decay_t<decltype(*std::begin(lists))>;
+    typename List::Timer timer(List::TimedOp::mergeAll, nullptr);
+    std::vector<const List*> inputs;
+    for(const List& list : lists) {
+        inputs.push_back(&list);
+    }
+    return List::mergeLists(inputs, threads);
+}
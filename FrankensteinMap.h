@@ -0,0 +1,133 @@
+#ifndef FRANKENSTEIN_S_LIST_FRANKENSTEINMAP_H
+#define FRANKENSTEIN_S_LIST_FRANKENSTEINMAP_H
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory_resource>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include "Node.h"
+#include "NodeStorage.h"
+
+// Map keeping its entries both in arrival order and in key order, on the FrankensteinList node
+// layout: next/prev chain the entries as they arrived, greater/lesser chain them by key. An
+// ordered index of node pointers finds a key in O(log n) and tells a new entry its neighbours
+// in the key chain, so neither chain is ever walked to insert or erase. Iteration follows the
+// chains and allocates nothing.
+template<typename K, typename V, typename Compare = std::less<K>>
+class FrankensteinMap {
+public:
+    using value_type = std::pair<const K, V>;
+    using NodeType = Node<value_type>;
+private:
+    using Storage = PointerNodeStorage<NodeType>;
+
+    // Orders nodes by their keys, and keys against nodes for lookups that create no node
+    struct KeyOrder {
+        using is_transparent = void;
+        Compare compare;
+        bool operator()(const NodeType *a, const NodeType *b) const { return compare(a->val.first, b->val.first); }
+        bool operator()(const NodeType *a, const K &b) const { return compare(a->val.first, b); }
+        bool operator()(const K &a, const NodeType *b) const { return compare(a, b->val.first); }
+    };
+    using Index = std::set<NodeType*, KeyOrder>;
+
+    template<typename Value>
+    std::pair<NodeType*, bool> emplaceKey(const K&, Value&&, bool);// Add an entry for a missing key, assigning an existing one with the flag
+    void linkNode(NodeType*, NodeType*) noexcept;// Link a new node at the back of the arrival order and in front of its key successor, null for none
+    void destroyNode(typename Index::iterator) noexcept;// Unlink an entry from both chains and the index and free it
+    void clear() noexcept;// Helper function for clearing the map
+public:
+
+    // Constructors and destructor
+    FrankensteinMap();// Default constructor
+    FrankensteinMap(std::initializer_list<std::pair<K, V>>);// Constructor with initializer list, a repeated key keeps its first arrival and its last value
+    explicit FrankensteinMap(std::pmr::memory_resource*);// Constructor allocating the nodes from a memory resource
+    FrankensteinMap(const FrankensteinMap&);// Copy constructor
+    FrankensteinMap(FrankensteinMap&&) noexcept;// Move constructor
+    ~FrankensteinMap();// Destructor
+
+    // Assignment operators
+    FrankensteinMap& operator=(const FrankensteinMap&);// Copy assignment operator
+    FrankensteinMap& operator=(FrankensteinMap&&) noexcept;// Move assignment operator
+
+    NodeType* find(const K&) const;// Get the entry of a key, null when absent
+    bool contains(const K&) const;// Check whether the key is present
+    V& at(const K&);// Get the value of a key, throws std::out_of_range when absent
+    const V& at(const K&) const;// Get the value of a key, throws std::out_of_range when absent
+    V& operator[](const K&);// Get the value of a key, adding a default one at the back of the arrival order when absent
+    bool insert(const K&, V);// Add an entry unless the key is present, true when added
+    bool insert_or_assign(const K&, V);// Add an entry or assign the value of the present one, true when added
+    bool erase(const K&);// Remove the entry of a key, true when it was present
+    void pop_front();// Remove the earliest arrival
+    void pop_back();// Remove the latest arrival
+    value_type& front();// Get the earliest arrival
+    value_type& back();// Get the latest arrival
+    NodeType* lowest() const;// Entry with the smallest key, null when empty
+    NodeType* highest() const;// Entry with the largest key, null when empty
+    bool empty() const;// Check if the map is empty
+    std::size_t getSize() const;// Get the number of entries
+    std::pmr::memory_resource* getMemoryResource() const;// Get the memory resource the nodes come from
+    void swap(FrankensteinMap&) noexcept;// Exchange the contents of two maps
+
+    // Iterators over arrival order (head) or key order (asc_head), forwards or backwards
+    enum class IteratorType : std::uint8_t {head, asc_head};
+    class Iterator {
+    public:
+        Iterator(NodeType*, IteratorType = IteratorType::head, bool = false);// Constructor, walking backwards with the flag
+
+        value_type& operator*();// Dereference operator, returns a reference to the current entry
+        value_type* operator->();// Arrow operator, returns a pointer to the current entry
+        Iterator& operator++();// Pre-increment operator, moves the iterator to the next entry
+        Iterator operator++(int);// Post-increment operator, moves the iterator to the next entry and returns the previous position
+        bool operator==(const Iterator&) const;// Equality operator, compares iterators for equality
+        bool operator!=(const Iterator&) const;// Inequality operator, compares iterators for inequality
+    private:
+        NodeType* ptr;// Pointer to the current node
+        IteratorType type;// Chain followed
+        bool backwards;// Whether the iterator walks the chain backwards
+    };
+
+    Iterator begin(IteratorType = IteratorType::head);// Earliest arrival or smallest key
+    Iterator end(IteratorType = IteratorType::head);// End iterator of either order
+    Iterator rbegin(IteratorType = IteratorType::head);// Latest arrival or largest key
+    Iterator rend(IteratorType = IteratorType::head);// End iterator of either backwards order
+
+    class ConstIterator {
+    public:
+        ConstIterator(const NodeType*, IteratorType = IteratorType::head, bool = false);// Constructor, walking backwards with the flag
+
+        const value_type& operator*() const;// Const dereference operator, returns a reference to the current entry
+        const value_type* operator->() const;// Const arrow operator, returns a pointer to the current entry
+        ConstIterator& operator++();// Pre-increment operator, moves the const iterator to the next entry
+        ConstIterator operator++(int);// Post-increment operator, moves the const iterator to the next entry and returns the previous position
+        bool operator==(const ConstIterator&) const;// Equality operator, compares const iterators for equality
+        bool operator!=(const ConstIterator&) const;// Inequality operator, compares const iterators for inequality
+    private:
+        const NodeType* ptr;// Pointer to the current node
+        IteratorType type;// Chain followed
+        bool backwards;// Whether the iterator walks the chain backwards
+    };
+
+    ConstIterator cbegin(IteratorType = IteratorType::head) const;// Const iterator at the earliest arrival or smallest key
+    ConstIterator cend(IteratorType = IteratorType::head) const;// Const end iterator of either order
+    ConstIterator crbegin(IteratorType = IteratorType::head) const;// Const iterator at the latest arrival or largest key
+    ConstIterator crend(IteratorType = IteratorType::head) const;// Const end iterator of either backwards order
+private:
+    Storage nodes;// Owner of the nodes
+    Index index;// Every node ordered by key
+    NodeType* head;// Earliest arrival
+    NodeType* tail;// Latest arrival
+    NodeType* asc_head;// Smallest key
+    NodeType* desc_head;// Largest key
+};
+
+// Swap two maps
+template<typename K, typename V, typename Compare>
+void swap(FrankensteinMap<K, V, Compare>&, FrankensteinMap<K, V, Compare>&) noexcept;
+
+#include "FrankensteinMap.tpp"
+
+#endif //FRANKENSTEIN_S_LIST_FRANKENSTEINMAP_H
@@ -0,0 +1,453 @@
+// Add an entry for a missing key, or with the flag assign the value of the present one. The index
+// finds the key's successor, which places the new node in the key chain without a walk.
+template<typename K, typename V, typename Compare>
+template<typename Value>
+std::pair<typename FrankensteinMap<K, V, Compare>::NodeType*, bool> FrankensteinMap<K, V, Compare>::emplaceKey(const K &key, Value &&val, bool assign) {
+    auto successor = index.lower_bound(key);
+    if(successor != index.end() && !index.key_comp()(key, *successor)) {
+        if(assign) (*successor)->val.second = std::forward<Value>(val);
+        return {*successor, false};
+    }
+    NodeType* node = nodes.create(value_type(key, std::forward<Value>(val)));
+    try {
+        index.emplace_hint(successor, node);
+    } catch(...) {
+        nodes.destroy(node);
+        throw;
+    }
+    linkNode(node, (successor == index.end()) ? nullptr : *successor);
+    return {node, true};
+}
+
+// Link a new node at the back of the arrival order and in front of its key successor, null for none
+template<typename K, typename V, typename Compare>
+void FrankensteinMap<K, V, Compare>::linkNode(NodeType *node, NodeType *successor) noexcept {
+    node->prev = tail;
+    if(tail) tail->next = node; else head = node;
+    tail = node;
+
+    NodeType* predecessor = successor ? successor->lesser : desc_head;
+    node->greater = successor;
+    node->lesser = predecessor;
+    if(successor) successor->lesser = node; else desc_head = node;
+    if(predecessor) predecessor->greater = node; else asc_head = node;
+}
+
+// Unlink an entry from both chains and the index and free it
+template<typename K, typename V, typename Compare>
+void FrankensteinMap<K, V, Compare>::destroyNode(typename Index::iterator it) noexcept {
+    NodeType* node = *it;
+    index.erase(it);
+    if(node->prev) node->prev->next = node->next; else head = node->next;
+    if(node->next) node->next->prev = node->prev; else tail = node->prev;
+    if(node->lesser) node->lesser->greater = node->greater; else asc_head = node->greater;
+    if(node->greater) node->greater->lesser = node->lesser; else desc_head = node->lesser;
+    nodes.destroy(node);
+}
+
+// Helper function for clearing the map
+template<typename K, typename V, typename Compare>
+void FrankensteinMap<K, V, Compare>::clear() noexcept {
+    index.clear();
+    bool dropped = false;
+    if constexpr (std::is_trivially_destructible<NodeType>::value) {
+        dropped = nodes.dropAll();
+    }
+    for(NodeType* curr = dropped ? nullptr : head; curr != nullptr; ) {
+        NodeType* next = curr->next;
+        nodes.destroy(curr);
+        curr = next;
+    }
+    head = nullptr;
+    tail = nullptr;
+    asc_head = nullptr;
+    desc_head = nullptr;
+}
+
+// Default constructor
+template<typename K, typename V, typename Compare>
+FrankensteinMap<K, V, Compare>::FrankensteinMap()
+        :head(nullptr), tail(nullptr), asc_head(nullptr), desc_head(nullptr)
+{
+}
+
+// Constructor with initializer list
+template<typename K, typename V, typename Compare>
+FrankensteinMap<K, V, Compare>::FrankensteinMap(std::initializer_list<std::pair<K, V>> list)
+        :FrankensteinMap()
+{
+    for(const auto& entry : list) {
+        insert_or_assign(entry.first, entry.second);
+    }
+}
+
+// Constructor allocating the nodes from a memory resource
+template<typename K, typename V, typename Compare>
+FrankensteinMap<K, V, Compare>::FrankensteinMap(std::pmr::memory_resource *resource)
+        :nodes(resource), head(nullptr), tail(nullptr), asc_head(nullptr), desc_head(nullptr)
+{
+}
+
+// Copy constructor: the entries arrive again in the same order
+template<typename K, typename V, typename Compare>
+FrankensteinMap<K, V, Compare>::FrankensteinMap(const FrankensteinMap &oth)
+        :FrankensteinMap(oth.getMemoryResource())
+{
+    index = Index(oth.index.key_comp());
+    try {
+        for(NodeType* curr = oth.head; curr != nullptr; curr = curr->next) {
+            insert(curr->val.first, curr->val.second);
+        }
+    } catch(...) {
+        clear();
+        throw;
+    }
+}
+
+// Move constructor
+template<typename K, typename V, typename Compare>
+FrankensteinMap<K, V, Compare>::FrankensteinMap(FrankensteinMap &&oth) noexcept
+        :nodes(std::move(oth.nodes)), index(std::move(oth.index)), head(oth.head), tail(oth.tail), asc_head(oth.asc_head), desc_head(oth.desc_head)
+{
+    oth.index.clear();
+    oth.head = nullptr;
+    oth.tail = nullptr;
+    oth.asc_head = nullptr;
+    oth.desc_head = nullptr;
+}
+
+// Destructor
+template<typename K, typename V, typename Compare>
+FrankensteinMap<K, V, Compare>::~FrankensteinMap() {
+    clear();
+}
+
+// Copy assignment operator
+template<typename K, typename V, typename Compare>
+FrankensteinMap<K, V, Compare>& FrankensteinMap<K, V, Compare>::operator=(const FrankensteinMap &oth) {
+    if(this != &oth) {
+        FrankensteinMap copy(oth);
+        swap(copy);
+    }
+    return *this;
+}
+
+// Move assignment operator
+template<typename K, typename V, typename Compare>
+FrankensteinMap<K, V, Compare>& FrankensteinMap<K, V, Compare>::operator=(FrankensteinMap &&oth) noexcept {
+    if(this != &oth) {
+        clear();
+        swap(oth);
+    }
+    return *this;
+}
+
+// Get the entry of a key, null when absent
+template<typename K, typename V, typename Compare>
+typename FrankensteinMap<K, V, Compare>::NodeType* FrankensteinMap<K, V, Compare>::find(const K &key) const {
+    auto it = index.find(key);
+    return (it == index.end()) ? nullptr : *it;
+}
+
+// Check whether the key is present
+template<typename K, typename V, typename Compare>
+bool FrankensteinMap<K, V, Compare>::contains(const K &key) const {
+    return index.find(key) != index.end();
+}
+
+// Get the value of a key
+template<typename K, typename V, typename Compare>
+V& FrankensteinMap<K, V, Compare>::at(const K &key) {
+    NodeType* node = find(key);
+    if(node == nullptr) {
+        throw std::out_of_range("Key is not in the map.");
+    }
+    return node->val.second;
+}
+
+// Get the value of a key
+template<typename K, typename V, typename Compare>
+const V& FrankensteinMap<K, V, Compare>::at(const K &key) const {
+    NodeType* node = find(key);
+    if(node == nullptr) {
+        throw std::out_of_range("Key is not in the map.");
+    }
+    return node->val.second;
+}
+
+// Get the value of a key, adding a default one when absent
+template<typename K, typename V, typename Compare>
+V& FrankensteinMap<K, V, Compare>::operator[](const K &key) {
+    auto it = index.find(key);
+    if(it != index.end()) return (*it)->val.second;
+    return emplaceKey(key, V(), false).first->val.second;
+}
+
+// Add an entry unless the key is present
+template<typename K, typename V, typename Compare>
+bool FrankensteinMap<K, V, Compare>::insert(const K &key, V val) {
+    return emplaceKey(key, std::move(val), false).second;
+}
+
+// Add an entry or assign the value of the present one; an assigned entry keeps its place in the arrival order
+template<typename K, typename V, typename Compare>
+bool FrankensteinMap<K, V, Compare>::insert_or_assign(const K &key, V val) {
+    return emplaceKey(key, std::move(val), true).second;
+}
+
+// Remove the entry of a key
+template<typename K, typename V, typename Compare>
+bool FrankensteinMap<K, V, Compare>::erase(const K &key) {
+    auto it = index.find(key);
+    if(it == index.end()) return false;
+    destroyNode(it);
+    return true;
+}
+
+// Remove the earliest arrival
+template<typename K, typename V, typename Compare>
+void FrankensteinMap<K, V, Compare>::pop_front() {
+    if(head == nullptr) {
+        throw std::runtime_error("Map is empty. Cannot pop_front.");
+    }
+    destroyNode(index.find(head));
+}
+
+// Remove the latest arrival
+template<typename K, typename V, typename Compare>
+void FrankensteinMap<K, V, Compare>::pop_back() {
+    if(tail == nullptr) {
+        throw std::runtime_error("Map is empty. Cannot pop_back.");
+    }
+    destroyNode(index.find(tail));
+}
+
+// Get the earliest arrival
+template<typename K, typename V, typename Compare>
+typename FrankensteinMap<K, V, Compare>::value_type& FrankensteinMap<K, V, Compare>::front() {
+    if(head == nullptr) {
+        throw std::runtime_error("Map is empty. Cannot access front element.");
+    }
+    return head->val;
+}
+
+// Get the latest arrival
+template<typename K, typename V, typename Compare>
+typename FrankensteinMap<K, V, Compare>::value_type& FrankensteinMap<K, V, Compare>::back() {
+    if(tail == nullptr) {
+        throw std::runtime_error("Map is empty. Cannot access back element.");
+    }
+    return tail->val;
+}
+
+// Entry with the smallest key
+template<typename K, typename V, typename Compare>
+typename FrankensteinMap<K, V, Compare>::NodeType* FrankensteinMap<K, V, Compare>::lowest() const {
+    return asc_head;
+}
+
+// Entry with the largest key
+template<typename K, typename V, typename Compare>
+typename FrankensteinMap<K, V, Compare>::NodeType* FrankensteinMap<K, V, Compare>::highest() const {
+    return desc_head;
+}
+
+// Check if the map is empty
+template<typename K, typename V, typename Compare>
+bool FrankensteinMap<K, V, Compare>::empty() const {
+    return head == nullptr;
+}
+
+// Get the number of entries
+template<typename K, typename V, typename Compare>
+std::size_t FrankensteinMap<K, V, Compare>::getSize() const {
+    return index.size();
+}
+
+// Get the memory resource the nodes come from
+template<typename K, typename V, typename Compare>
+std::pmr::memory_resource* FrankensteinMap<K, V, Compare>::getMemoryResource() const {
+    return nodes.resource();
+}
+
+// Exchange the contents of two maps
+template<typename K, typename V, typename Compare>
+void FrankensteinMap<K, V, Compare>::swap(FrankensteinMap &oth) noexcept {
+    using std::swap;
+    nodes.swap(oth.nodes);
+    index.swap(oth.index);
+    swap(head, oth.head);
+    swap(tail, oth.tail);
+    swap(asc_head, oth.asc_head);
+    swap(desc_head, oth.desc_head);
+}
+
+// Iterator constructor
+template<typename K, typename V, typename Compare>
+FrankensteinMap<K, V, Compare>::Iterator::Iterator(NodeType *node, IteratorType t, bool b)
+    :ptr(node), type(t), backwards(b)
+{
+}
+
+// Dereference operator for Iterator
+template<typename K, typename V, typename Compare>
+typename FrankensteinMap<K, V, Compare>::value_type& FrankensteinMap<K, V, Compare>::Iterator::operator*() {
+    if(!ptr) {
+        throw std::runtime_error("Dereferencing end iterator");
+    }
+    return ptr->val;
+}
+
+// Arrow operator for Iterator
+template<typename K, typename V, typename Compare>
+typename FrankensteinMap<K, V, Compare>::value_type* FrankensteinMap<K, V, Compare>::Iterator::operator->() {
+    if(!ptr) {
+        throw std::runtime_error("Dereferencing end iterator");
+    }
+    return &ptr->val;
+}
+
+// Pre-increment operator for Iterator
+template<typename K, typename V, typename Compare>
+typename FrankensteinMap<K, V, Compare>::Iterator& FrankensteinMap<K, V, Compare>::Iterator::operator++() {
+    if(ptr) {
+        if(type == IteratorType::head) {
+            ptr = backwards ? ptr->prev : ptr->next;
+        } else {
+            ptr = backwards ? ptr->lesser : ptr->greater;
+        }
+    }
+    return *this;
+}
+
+// Post-increment operator for Iterator
+template<typename K, typename V, typename Compare>
+typename FrankensteinMap<K, V, Compare>::Iterator FrankensteinMap<K, V, Compare>::Iterator::operator++(int) {
+    Iterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+// Equality operator for Iterator
+template<typename K, typename V, typename Compare>
+bool FrankensteinMap<K, V, Compare>::Iterator::operator==(const Iterator &oth) const {
+    return ptr == oth.ptr;
+}
+
+// Inequality operator for Iterator
+template<typename K, typename V, typename Compare>
+bool FrankensteinMap<K, V, Compare>::Iterator::operator!=(const Iterator &oth) const {
+    return ptr != oth.ptr;
+}
+
+// Earliest arrival or smallest key
+template<typename K, typename V, typename Compare>
+typename FrankensteinMap<K, V, Compare>::Iterator FrankensteinMap<K, V, Compare>::begin(IteratorType type) {
+    return Iterator((type == IteratorType::head) ? head : asc_head, type);
+}
+
+// End iterator
+template<typename K, typename V, typename Compare>
+typename FrankensteinMap<K, V, Compare>::Iterator FrankensteinMap<K, V, Compare>::end(IteratorType type) {
+    return Iterator(nullptr, type);
+}
+
+// Latest arrival or largest key
+template<typename K, typename V, typename Compare>
+typename FrankensteinMap<K, V, Compare>::Iterator FrankensteinMap<K, V, Compare>::rbegin(IteratorType type) {
+    return Iterator((type == IteratorType::head) ? tail : desc_head, type, true);
+}
+
+// End iterator of a backwards walk
+template<typename K, typename V, typename Compare>
+typename FrankensteinMap<K, V, Compare>::Iterator FrankensteinMap<K, V, Compare>::rend(IteratorType type) {
+    return Iterator(nullptr, type, true);
+}
+
+// ConstIterator constructor
+template<typename K, typename V, typename Compare>
+FrankensteinMap<K, V, Compare>::ConstIterator::ConstIterator(const NodeType *node, IteratorType t, bool b)
+    :ptr(node), type(t), backwards(b)
+{
+}
+
+// Dereference operator for ConstIterator
+template<typename K, typename V, typename Compare>
+const typename FrankensteinMap<K, V, Compare>::value_type& FrankensteinMap<K, V, Compare>::ConstIterator::operator*() const {
+    if(!ptr) {
+        throw std::runtime_error("Dereferencing end iterator");
+    }
+    return ptr->val;
+}
+
+// Arrow operator for ConstIterator
+template<typename K, typename V, typename Compare>
+const typename FrankensteinMap<K, V, Compare>::value_type* FrankensteinMap<K, V, Compare>::ConstIterator::operator->() const {
+    if(!ptr) {
+        throw std::runtime_error("Dereferencing end iterator");
+    }
+    return &ptr->val;
+}
+
+// Pre-increment operator for ConstIterator
+template<typename K, typename V, typename Compare>
+typename FrankensteinMap<K, V, Compare>::ConstIterator& FrankensteinMap<K, V, Compare>::ConstIterator::operator++() {
+    if(ptr) {
+        if(type == IteratorType::head) {
+            ptr = backwards ? ptr->prev : ptr->next;
+        } else {
+            ptr = backwards ? ptr->lesser : ptr->greater;
+        }
+    }
+    return *this;
+}
+
+// Post-increment operator for ConstIterator
+template<typename K, typename V, typename Compare>
+typename FrankensteinMap<K, V, Compare>::ConstIterator FrankensteinMap<K, V, Compare>::ConstIterator::operator++(int) {
+    ConstIterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+// Equality operator for ConstIterator
+template<typename K, typename V, typename Compare>
+bool FrankensteinMap<K, V, Compare>::ConstIterator::operator==(const ConstIterator &oth) const {
+    return ptr == oth.ptr;
+}
+
+// Inequality operator for ConstIterator
+template<typename K, typename V, typename Compare>
+bool FrankensteinMap<K, V, Compare>::ConstIterator::operator!=(const ConstIterator &oth) const {
+    return ptr != oth.ptr;
+}
+
+// Const iterator at the earliest arrival or smallest key
+template<typename K, typename V, typename Compare>
+typename FrankensteinMap<K, V, Compare>::ConstIterator FrankensteinMap<K, V, Compare>::cbegin(IteratorType type) const {
+    return ConstIterator((type == IteratorType::head) ? head : asc_head, type);
+}
+
+// Const end iterator
+template<typename K, typename V, typename Compare>
+typename FrankensteinMap<K, V, Compare>::ConstIterator FrankensteinMap<K, V, Compare>::cend(IteratorType type) const {
+    return ConstIterator(nullptr, type);
+}
+
+// Const iterator at the latest arrival or largest key
+template<typename K, typename V, typename Compare>
+typename FrankensteinMap<K, V, Compare>::ConstIterator FrankensteinMap<K, V, Compare>::crbegin(IteratorType type) const {
+    return ConstIterator((type == IteratorType::head) ? tail : desc_head, type, true);
+}
+
+// Const end iterator of a backwards walk
+template<typename K, typename V, typename Compare>
+typename FrankensteinMap<K, V, Compare>::ConstIterator FrankensteinMap<K, V, Compare>::crend(IteratorType type) const {
+    return ConstIterator(nullptr, type, true);
+}
+
+// Swap two maps
+template<typename K, typename V, typename Compare>
+void swap(FrankensteinMap<K, V, Compare> &first, FrankensteinMap<K, V, Compare> &second) noexcept {
+    first.swap(second);
+}
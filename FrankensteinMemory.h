@@ -0,0 +1,126 @@
+#ifndef FRANKENSTEIN_S_LIST_FRANKENSTEINMEMORY_H
+#define FRANKENSTEIN_S_LIST_FRANKENSTEINMEMORY_H
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <memory_resource>
+
+// Node memory held by a storage, as reported by its footprint(). Counted from the storage's
+// own bookkeeping, so taking it costs no walk over the nodes.
+struct StorageFootprint {
+    std::size_t slots = 0;// Node slots held, inline or from the memory resource
+    std::size_t handedOut = 0;// Slots given to nodes and not returned to the resource: live nodes plus recycled slots
+    std::size_t inlineBytes = 0;// Bytes of the slots inside the storage object itself
+    std::size_t heapBytes = 0;// Bytes of slots requested from the memory resource
+    std::size_t allocatorBytes = 0;// The resource's estimated overhead on those requests
+    std::size_t tableBytes = 0;// Heap bytes of the storage's own tables
+};
+
+// Memory report of a list, see FrankensteinList::memory_usage(). Reports add up with +=.
+struct MemoryUsage {
+    std::size_t nodes = 0;// Values held
+    std::size_t valueBytes = 0;// Bytes of the values themselves; memory a value allocates on its own is not seen
+    std::size_t linkBytes = 0;// The rest of the node bytes: links, jump hints, chunk headers and padding
+    std::size_t freeBytes = 0;// Slots recycled into free lists or left dead in slabs, reusable by the same list only
+    std::size_t slackBytes = 0;// Slots reserved but never handed out, plus the allocator's estimated per-allocation overhead
+    std::size_t overheadBytes = 0;// The list object and the storage's tables
+
+    std::size_t totalBytes() const {// Everything above
+        return valueBytes + linkBytes + freeBytes + slackBytes + overheadBytes;
+    }
+
+    double fragmentation() const {// Share of the node memory not holding a node, 0 for a list without any
+        std::size_t unused = freeBytes + slackBytes;
+        std::size_t held = valueBytes + linkBytes + unused;
+        return held ? static_cast<double>(unused) / static_cast<double>(held) : 0.0;
+    }
+
+    MemoryUsage& operator+=(const MemoryUsage &oth) {
+        nodes += oth.nodes;
+        valueBytes += oth.valueBytes;
+        linkBytes += oth.linkBytes;
+        freeBytes += oth.freeBytes;
+        slackBytes += oth.slackBytes;
+        overheadBytes += oth.overheadBytes;
+        return *this;
+    }
+};
+
+// Memory resource counting what passes through it to another resource. Lists sharing it
+// see their combined allocations, including what their own reports cannot see: memory the
+// values allocate, and node memory a monotonic resource keeps after the nodes are gone.
+class CountingMemoryResource : public std::pmr::memory_resource {
+public:
+    explicit CountingMemoryResource(std::pmr::memory_resource *upstream = std::pmr::get_default_resource()) noexcept
+            :source(upstream)
+    {
+    }
+
+    std::size_t bytes() const noexcept {// Bytes allocated and not yet deallocated
+        return current.load(std::memory_order_relaxed);
+    }
+    std::size_t peakBytes() const noexcept {// Most bytes allocated at once
+        return peak.load(std::memory_order_relaxed);
+    }
+    std::size_t allocations() const noexcept {// Allocations not yet deallocated
+        return live.load(std::memory_order_relaxed);
+    }
+    std::pmr::memory_resource* upstream() const noexcept {// Resource the allocations go to
+        return source;
+    }
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        void* p = source->allocate(bytes, alignment);
+        std::size_t now = current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        std::size_t seen = peak.load(std::memory_order_relaxed);
+        while(now > seen && !peak.compare_exchange_weak(seen, now, std::memory_order_relaxed)) {
+        }
+        live.fetch_add(1, std::memory_order_relaxed);
+        return p;
+    }
+
+    void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override {
+        source->deallocate(p, bytes, alignment);
+        current.fetch_sub(bytes, std::memory_order_relaxed);
+        live.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &oth) const noexcept override {
+        return this == &oth;
+    }
+
+    std::pmr::memory_resource* source;
+    std::atomic<std::size_t> current{0};
+    std::atomic<std::size_t> peak{0};
+    std::atomic<std::size_t> live{0};
+};
+
+namespace frankenstein_memory {
+    // Bytes a resource spends on one allocation beyond the ones requested. Known for operator new
+    // on glibc: an 8-byte chunk header, chunks rounded up to 16 bytes and at least 32. Other
+    // resources are taken to spend nothing extra.
+    inline std::size_t allocationOverhead(const std::pmr::memory_resource *resource, std::size_t bytes) noexcept {
+        while(auto counting = dynamic_cast<const CountingMemoryResource*>(resource)) {
+            resource = counting->upstream();
+        }
+        if(resource != std::pmr::new_delete_resource()) return 0;
+#if defined(__GLIBC__)
+        std::size_t chunk = (bytes + sizeof(std::size_t) + 15) / 16 * 16;
+        return ((chunk < 32) ? 32 : chunk) - bytes;
+#else
+        return 0;
+#endif
+    }
+}
+
+// Memory reports of many lists added up, e.g. of every list sharing a memory resource
+template<typename Range>
+MemoryUsage total_memory_usage(const Range &lists) {
+    MemoryUsage total;
+    for(const auto& list : lists) {
+        total += list.memory_usage();
+    }
+    return total;
+}
+
+#endif //FRANKENSTEIN_S_LIST_FRANKENSTEINMEMORY_H
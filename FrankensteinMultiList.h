@@ -0,0 +1,198 @@
+#ifndef FRANKENSTEIN_S_LIST_FRANKENSTEINMULTILIST_H
+#define FRANKENSTEIN_S_LIST_FRANKENSTEINMULTILIST_H
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory_resource>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "Node.h"
+#include "NodeStorage.h"
+
+// Key extractors for the indexes of FrankensteinMultiList
+
+// The element itself is the key
+struct IdentityKey {
+    template<typename T>
+    const T& operator()(const T &val) const noexcept {
+        return val;
+    }
+};
+
+// A data member of the element is the key, e.g. MemberKey<&Order::price>
+template<auto Member>
+struct MemberKey {
+    template<typename T>
+    const auto& operator()(const T &val) const noexcept {
+        return val.*Member;
+    }
+};
+
+// A sorted index: the key of an element is KeyOf()(element), keys are ordered by Compare
+template<typename KeyOf, typename Compare = std::less<>>
+struct SortedIndex {
+    using key_of = KeyOf;
+    using compare = Compare;
+};
+
+// Index on a data member, e.g. ByMember<&Order::price, std::greater<>>
+template<auto Member, typename Compare = std::less<>>
+using ByMember = SortedIndex<MemberKey<Member>, Compare>;
+
+// FrankensteinList with several sorted views. Every element sits in the insertion chain and
+// in one greater/lesser chain per index, ordered by that index's key. The indexes are fixed at
+// compile time, so a node carries exactly one link pair per index and every key extraction and
+// comparison is inlined. Insertion puts a node into every index the way FrankensteinList puts
+// it into its sorted chain; removal unlinks it from all of them in O(1) per index.
+template<typename T, typename... Index>
+class FrankensteinMultiList {
+    static_assert(sizeof...(Index) > 0, "A multi-list needs at least one sorted index");
+public:
+    static constexpr std::size_t indexes = sizeof...(Index);
+    static constexpr std::size_t insertion = indexes;// View of the iterators following insertion order
+    using NodeType = MultiNode<T, indexes>;
+    template<std::size_t I>
+    using IndexAt = std::tuple_element_t<I, std::tuple<Index...>>;// Declaration of index I
+    template<std::size_t I>
+    using key_type = std::decay_t<std::invoke_result_t<typename IndexAt<I>::key_of, const T&>>;// Key type of index I
+private:
+    using Storage = PointerNodeStorage<NodeType>;
+    using Indexes = std::make_index_sequence<indexes>;
+
+    struct Ends {
+        NodeType* lowest;// First node in the index order
+        NodeType* highest;// Last node in the index order
+    };
+
+    template<std::size_t I>
+    static decltype(auto) key(const T&);// Key of an element in index I
+    template<std::size_t I, typename A, typename B>
+    static bool less(const A&, const B&);// Order two keys of index I
+    template<typename... Args>
+    NodeType* createNode(Args&&...);// Construct a node with no links
+    NodeType* nodeAt(std::size_t) const;// Get the node at a specified position
+    void linkInsertion(NodeType*, NodeType*) noexcept;// Link a node into the insertion chain after another one, at the front for null
+    void unlinkInsertion(NodeType*) noexcept;// Detach a node from the insertion chain
+    template<std::size_t I>
+    NodeType* sortedPrev(const NodeType*) const;// Find the predecessor of a new node in index I
+    template<std::size_t I>
+    void linkSorted(NodeType*, NodeType*) noexcept;// Link a node into index I after its predecessor
+    template<std::size_t I>
+    void unlinkSorted(NodeType*) noexcept;// Detach a node from index I
+    template<std::size_t... I>
+    void linkIndexes(NodeType*, std::index_sequence<I...>);// Put a node into every index, all predecessors found before anything is linked
+    template<std::size_t... I>
+    void unlinkIndexes(NodeType*, std::index_sequence<I...>) noexcept;// Detach a node from every index
+    void insertNode(NodeType*, NodeType*);// Link a new node after an insertion predecessor and into every index, freeing it on failure
+    void destroyNode(NodeType*) noexcept;// Detach a node from every chain and free it
+    template<std::size_t I>
+    NodeType* lowerBound(const key_type<I>&) const;// First node of index I whose key is not smaller, null when there is none
+    void clear() noexcept;// Helper function for clearing the list
+public:
+
+    // Constructors and destructor
+    FrankensteinMultiList();// Default constructor
+    FrankensteinMultiList(std::initializer_list<T>);// Constructor with initializer list
+    explicit FrankensteinMultiList(std::pmr::memory_resource*);// Constructor allocating the nodes from a memory resource
+    FrankensteinMultiList(const FrankensteinMultiList&);// Copy constructor
+    FrankensteinMultiList(FrankensteinMultiList&&) noexcept;// Move constructor
+    ~FrankensteinMultiList();// Destructor
+
+    // Assignment operators
+    FrankensteinMultiList& operator=(const FrankensteinMultiList&);// Copy assignment operator
+    FrankensteinMultiList& operator=(FrankensteinMultiList&&) noexcept;// Move assignment operator
+
+    void push_back(const T&);// Insert an element at the back
+    void push_front(const T&);// Insert an element at the front
+    template<typename... Args>
+    NodeType* emplace_back(Args&&...);// Construct an element at the back in place
+    void insertAt(const T&, std::size_t);// Insert an element at a specified position
+    void pop_front();// Remove the element from the front
+    void pop_back();// Remove the element from the back
+    T& front();// Get a reference to the front element
+    T& back();// Get a reference to the back element
+    void erase(std::size_t);// Erase the element at a specific position
+    void erase(std::size_t, std::size_t);// Erase a range of elements starting at a specific position
+    void erase(NodeType*);// Erase an element found by a lookup
+    template<typename Modify>
+    void modify(NodeType*, Modify&&);// Change an element in place, then move it to its new place in every index
+    bool empty() const;// Check if the list is empty
+    std::size_t getSize() const;// Get the current size of the list
+    std::pmr::memory_resource* getMemoryResource() const;// Get the memory resource the nodes come from
+    void swap(FrankensteinMultiList&) noexcept;// Exchange the contents of two lists
+
+    // Lookups by the key of one index, along its sorted chain
+    template<std::size_t I>
+    NodeType* find(const key_type<I>&) const;// First element with the key in the order of index I, null when absent
+    template<std::size_t I>
+    bool contains(const key_type<I>&) const;// Check whether an element has the key
+    template<std::size_t I>
+    std::size_t count(const key_type<I>&) const;// Count the elements with the key
+    template<std::size_t I>
+    void remove(const key_type<I>&);// Remove every element with the key
+    template<std::size_t I>
+    NodeType* lowest() const;// Element with the smallest key of index I, null when empty
+    template<std::size_t I>
+    NodeType* highest() const;// Element with the largest key of index I, null when empty
+
+    // Iterators over the insertion order or one index. Elements must be changed through modify(),
+    // changing a key through an iterator leaves the element out of place in its index.
+    class Iterator {
+    public:
+        Iterator(NodeType*, std::size_t = insertion, bool = false);// Constructor: an index or insertion, walking backwards with the flag
+
+        T& operator*();// Dereference operator, returns a reference to the current element
+        T* operator->();// Arrow operator, returns a pointer to the current element
+        Iterator& operator++();// Pre-increment operator, moves the iterator to the next element
+        Iterator operator++(int);// Post-increment operator, moves the iterator to the next element and returns the previous position
+        bool operator==(const Iterator&) const;// Equality operator, compares iterators for equality
+        bool operator!=(const Iterator&) const;// Inequality operator, compares iterators for inequality
+    private:
+        NodeType* ptr;// Pointer to the current node
+        std::size_t view;// Index followed, insertion for the insertion chain
+        bool backwards;// Whether the iterator walks the chain backwards
+    };
+
+    Iterator begin(std::size_t = insertion);// First element of the insertion order or ascending in an index
+    Iterator end(std::size_t = insertion);// End iterator of any view
+    Iterator rbegin(std::size_t = insertion);// Last element of the insertion order or descending in an index
+    Iterator rend(std::size_t = insertion);// End iterator of any backwards view
+
+    class ConstIterator {
+    public:
+        ConstIterator(const NodeType*, std::size_t = insertion, bool = false);// Constructor: an index or insertion, walking backwards with the flag
+
+        const T& operator*() const;// Const dereference operator, returns a reference to the current element
+        const T* operator->() const;// Const arrow operator, returns a pointer to the current element
+        ConstIterator& operator++();// Pre-increment operator, moves the const iterator to the next element
+        ConstIterator operator++(int);// Post-increment operator, moves the const iterator to the next element and returns the previous position
+        bool operator==(const ConstIterator&) const;// Equality operator, compares const iterators for equality
+        bool operator!=(const ConstIterator&) const;// Inequality operator, compares const iterators for inequality
+    private:
+        const NodeType* ptr;// Pointer to the current node
+        std::size_t view;// Index followed, insertion for the insertion chain
+        bool backwards;// Whether the iterator walks the chain backwards
+    };
+
+    ConstIterator cbegin(std::size_t = insertion) const;// Const begin iterator of a view
+    ConstIterator cend(std::size_t = insertion) const;// Const end iterator of any view
+    ConstIterator crbegin(std::size_t = insertion) const;// Const backwards begin iterator of a view
+    ConstIterator crend(std::size_t = insertion) const;// Const end iterator of any backwards view
+private:
+    Storage nodes;// Owner of the nodes
+    NodeType* head;// First node in insertion order
+    NodeType* tail;// Last node in insertion order
+    std::array<Ends, indexes> ends;// Both ends of every index
+    std::size_t size;// Current size of the list
+};
+
+// Swap two multi-lists
+template<typename T, typename... Index>
+void swap(FrankensteinMultiList<T, Index...>&, FrankensteinMultiList<T, Index...>&) noexcept;
+
+#include "FrankensteinMultiList.tpp"
+
+#endif //FRANKENSTEIN_S_LIST_FRANKENSTEINMULTILIST_H
@@ -0,0 +1,599 @@
+// Key of an element in index I
+template<typename T, typename... Index>
+template<std::size_t I>
+decltype(auto) FrankensteinMultiList<T, Index...>::key(const T &val) {
+    return typename IndexAt<I>::key_of()(val);
+}
+
+// Order two keys of index I
+template<typename T, typename... Index>
+template<std::size_t I, typename A, typename B>
+bool FrankensteinMultiList<T, Index...>::less(const A &a, const B &b) {
+    return typename IndexAt<I>::compare()(a, b);
+}
+
+// Construct a node with no links
+template<typename T, typename... Index>
+template<typename... Args>
+typename FrankensteinMultiList<T, Index...>::NodeType* FrankensteinMultiList<T, Index...>::createNode(Args&&... args) {
+    return nodes.create(std::in_place, std::forward<Args>(args)...);
+}
+
+// Get the node at a specified position, walking from the nearer end
+template<typename T, typename... Index>
+typename FrankensteinMultiList<T, Index...>::NodeType* FrankensteinMultiList<T, Index...>::nodeAt(std::size_t pos) const {
+    if(pos >= size) {
+        throw std::out_of_range("Position is out of range.");
+    }
+    NodeType* curr;
+    if(pos < size / 2) {
+        for(curr = head; pos; --pos) curr = curr->next;
+    } else {
+        for(curr = tail, pos = size - 1 - pos; pos; --pos) curr = curr->prev;
+    }
+    return curr;
+}
+
+// Link a node into the insertion chain after another one, at the front for null
+template<typename T, typename... Index>
+void FrankensteinMultiList<T, Index...>::linkInsertion(NodeType *node, NodeType *prev) noexcept {
+    node->prev = prev;
+    node->next = prev ? prev->next : head;
+    if(node->next) node->next->prev = node; else tail = node;
+    if(prev) prev->next = node; else head = node;
+}
+
+// Detach a node from the insertion chain
+template<typename T, typename... Index>
+void FrankensteinMultiList<T, Index...>::unlinkInsertion(NodeType *node) noexcept {
+    if(node->prev) node->prev->next = node->next; else head = node->next;
+    if(node->next) node->next->prev = node->prev; else tail = node->prev;
+}
+
+// Find the predecessor of a new node in index I: the last node with a smaller key. A node
+// whose key is above the largest one goes behind it without a walk, as in FrankensteinList;
+// a duplicate of the largest walks to the front of its equals like any other.
+template<typename T, typename... Index>
+template<std::size_t I>
+typename FrankensteinMultiList<T, Index...>::NodeType* FrankensteinMultiList<T, Index...>::sortedPrev(const NodeType *node) const {
+    const auto& k = key<I>(node->val);
+    NodeType* highest = ends[I].highest;
+    if(highest == nullptr || less<I>(key<I>(highest->val), k)) {
+        return highest;
+    }
+    NodeType* prev = nullptr;
+    for(NodeType* curr = ends[I].lowest; less<I>(key<I>(curr->val), k); curr = curr->sorted[I].greater) {
+        prev = curr;
+    }
+    return prev;
+}
+
+// Link a node into index I after its predecessor, at the low end for null
+template<typename T, typename... Index>
+template<std::size_t I>
+void FrankensteinMultiList<T, Index...>::linkSorted(NodeType *node, NodeType *prev) noexcept {
+    auto& links = node->sorted[I];
+    links.lesser = prev;
+    links.greater = prev ? prev->sorted[I].greater : ends[I].lowest;
+    if(links.greater) links.greater->sorted[I].lesser = node; else ends[I].highest = node;
+    if(prev) prev->sorted[I].greater = node; else ends[I].lowest = node;
+}
+
+// Detach a node from index I
+template<typename T, typename... Index>
+template<std::size_t I>
+void FrankensteinMultiList<T, Index...>::unlinkSorted(NodeType *node) noexcept {
+    auto& links = node->sorted[I];
+    if(links.lesser) links.lesser->sorted[I].greater = links.greater; else ends[I].lowest = links.greater;
+    if(links.greater) links.greater->sorted[I].lesser = links.lesser; else ends[I].highest = links.lesser;
+}
+
+// Put a node into every index. The predecessors are found first, so a throwing key or
+// comparison leaves every index untouched.
+template<typename T, typename... Index>
+template<std::size_t... I>
+void FrankensteinMultiList<T, Index...>::linkIndexes(NodeType *node, std::index_sequence<I...>) {
+    std::array<NodeType*, indexes> prevs = {sortedPrev<I>(node)...};
+    (linkSorted<I>(node, prevs[I]), ...);
+}
+
+// Detach a node from every index
+template<typename T, typename... Index>
+template<std::size_t... I>
+void FrankensteinMultiList<T, Index...>::unlinkIndexes(NodeType *node, std::index_sequence<I...>) noexcept {
+    (unlinkSorted<I>(node), ...);
+}
+
+// Link a new node after an insertion predecessor and into every index, freeing it when an index cannot take it
+template<typename T, typename... Index>
+void FrankensteinMultiList<T, Index...>::insertNode(NodeType *node, NodeType *prev) {
+    try {
+        linkIndexes(node, Indexes());
+    } catch(...) {
+        nodes.destroy(node);
+        throw;
+    }
+    linkInsertion(node, prev);
+    ++size;
+}
+
+// Detach a node from every chain and free it
+template<typename T, typename... Index>
+void FrankensteinMultiList<T, Index...>::destroyNode(NodeType *node) noexcept {
+    unlinkInsertion(node);
+    unlinkIndexes(node, Indexes());
+    nodes.destroy(node);
+    --size;
+}
+
+// First node of index I whose key is not smaller than the given one
+template<typename T, typename... Index>
+template<std::size_t I>
+typename FrankensteinMultiList<T, Index...>::NodeType* FrankensteinMultiList<T, Index...>::lowerBound(const key_type<I> &k) const {
+    NodeType* highest = ends[I].highest;
+    if(highest == nullptr || less<I>(key<I>(highest->val), k)) return nullptr;
+    NodeType* curr = ends[I].lowest;
+    while(less<I>(key<I>(curr->val), k)) {
+        curr = curr->sorted[I].greater;
+    }
+    return curr;
+}
+
+// Helper function for clearing the list
+template<typename T, typename... Index>
+void FrankensteinMultiList<T, Index...>::clear() noexcept {
+    bool dropped = false;
+    if constexpr (std::is_trivially_destructible<NodeType>::value) {
+        dropped = nodes.dropAll();
+    }
+    for(NodeType* curr = dropped ? nullptr : head; curr != nullptr; ) {
+        NodeType* next = curr->next;
+        nodes.destroy(curr);
+        curr = next;
+    }
+    head = nullptr;
+    tail = nullptr;
+    ends = {};
+    size = 0;
+}
+
+// Default constructor
+template<typename T, typename... Index>
+FrankensteinMultiList<T, Index...>::FrankensteinMultiList()
+        :head(nullptr), tail(nullptr), ends{}, size(0)
+{
+}
+
+// Constructor with initializer list
+template<typename T, typename... Index>
+FrankensteinMultiList<T, Index...>::FrankensteinMultiList(std::initializer_list<T> list)
+        :FrankensteinMultiList()
+{
+    for(const T& val : list) {
+        push_back(val);
+    }
+}
+
+// Constructor allocating the nodes from a memory resource
+template<typename T, typename... Index>
+FrankensteinMultiList<T, Index...>::FrankensteinMultiList(std::pmr::memory_resource *resource)
+        :nodes(resource), head(nullptr), tail(nullptr), ends{}, size(0)
+{
+}
+
+// Copy constructor: the elements are added again in insertion order, which rebuilds every index
+template<typename T, typename... Index>
+FrankensteinMultiList<T, Index...>::FrankensteinMultiList(const FrankensteinMultiList &oth)
+        :FrankensteinMultiList(oth.getMemoryResource())
+{
+    try {
+        for(NodeType* curr = oth.head; curr != nullptr; curr = curr->next) {
+            push_back(curr->val);
+        }
+    } catch(...) {
+        clear();
+        throw;
+    }
+}
+
+// Move constructor
+template<typename T, typename... Index>
+FrankensteinMultiList<T, Index...>::FrankensteinMultiList(FrankensteinMultiList &&oth) noexcept
+        :nodes(std::move(oth.nodes)), head(oth.head), tail(oth.tail), ends(oth.ends), size(oth.size)
+{
+    oth.head = nullptr;
+    oth.tail = nullptr;
+    oth.ends = {};
+    oth.size = 0;
+}
+
+// Destructor
+template<typename T, typename... Index>
+FrankensteinMultiList<T, Index...>::~FrankensteinMultiList() {
+    clear();
+}
+
+// Copy assignment operator
+template<typename T, typename... Index>
+FrankensteinMultiList<T, Index...>& FrankensteinMultiList<T, Index...>::operator=(const FrankensteinMultiList &oth) {
+    if(this != &oth) {
+        FrankensteinMultiList copy(oth);
+        swap(copy);
+    }
+    return *this;
+}
+
+// Move assignment operator
+template<typename T, typename... Index>
+FrankensteinMultiList<T, Index...>& FrankensteinMultiList<T, Index...>::operator=(FrankensteinMultiList &&oth) noexcept {
+    if(this != &oth) {
+        clear();
+        swap(oth);
+    }
+    return *this;
+}
+
+// Insert an element at the back
+template<typename T, typename... Index>
+void FrankensteinMultiList<T, Index...>::push_back(const T &val) {
+    insertNode(createNode(val), tail);
+}
+
+// Insert an element at the front
+template<typename T, typename... Index>
+void FrankensteinMultiList<T, Index...>::push_front(const T &val) {
+    insertNode(createNode(val), nullptr);
+}
+
+// Construct an element at the back in place
+template<typename T, typename... Index>
+template<typename... Args>
+typename FrankensteinMultiList<T, Index...>::NodeType* FrankensteinMultiList<T, Index...>::emplace_back(Args&&... args) {
+    NodeType* node = createNode(std::forward<Args>(args)...);
+    insertNode(node, tail);
+    return node;
+}
+
+// Insert an element at a specified position
+template<typename T, typename... Index>
+void FrankensteinMultiList<T, Index...>::insertAt(const T &val, std::size_t pos) {
+    if(pos > size) {
+        throw std::out_of_range("Position is out of range.");
+    }
+    NodeType* prev = (pos == 0) ? nullptr : nodeAt(pos - 1);
+    insertNode(createNode(val), prev);
+}
+
+// Remove the element from the front
+template<typename T, typename... Index>
+void FrankensteinMultiList<T, Index...>::pop_front() {
+    if(head == nullptr) {
+        throw std::runtime_error("List is empty. Cannot pop_front.");
+    }
+    destroyNode(head);
+}
+
+// Remove the element from the back
+template<typename T, typename... Index>
+void FrankensteinMultiList<T, Index...>::pop_back() {
+    if(tail == nullptr) {
+        throw std::runtime_error("List is empty. Cannot pop_back.");
+    }
+    destroyNode(tail);
+}
+
+// Get a reference to the front element
+template<typename T, typename... Index>
+T& FrankensteinMultiList<T, Index...>::front() {
+    if(head == nullptr) {
+        throw std::runtime_error("List is empty. Cannot access front element.");
+    }
+    return head->val;
+}
+
+// Get a reference to the back element
+template<typename T, typename... Index>
+T& FrankensteinMultiList<T, Index...>::back() {
+    if(tail == nullptr) {
+        throw std::runtime_error("List is empty. Cannot access back element.");
+    }
+    return tail->val;
+}
+
+// Erase the element at a specific position
+template<typename T, typename... Index>
+void FrankensteinMultiList<T, Index...>::erase(std::size_t pos) {
+    destroyNode(nodeAt(pos));
+}
+
+// Erase a range of elements starting at a specific position
+template<typename T, typename... Index>
+void FrankensteinMultiList<T, Index...>::erase(std::size_t pos, std::size_t count) {
+    if(pos > size || count > size - pos) {
+        throw std::out_of_range("Position is out of range.");
+    }
+    if(count == 0) return;
+    for(NodeType* curr = nodeAt(pos); count; --count) {
+        NodeType* next = curr->next;
+        destroyNode(curr);
+        curr = next;
+    }
+}
+
+// Erase an element found by a lookup or an iterator
+template<typename T, typename... Index>
+void FrankensteinMultiList<T, Index...>::erase(NodeType *node) {
+    if(node == nullptr) {
+        throw std::invalid_argument("Cannot erase a null node.");
+    }
+    destroyNode(node);
+}
+
+// Change an element in place, then move it to its new place in every index. The node keeps its
+// place in the insertion order. If the change or a key throws, the element is removed instead
+// of being left out of order.
+template<typename T, typename... Index>
+template<typename Modify>
+void FrankensteinMultiList<T, Index...>::modify(NodeType *node, Modify &&change) {
+    unlinkIndexes(node, Indexes());
+    try {
+        std::forward<Modify>(change)(node->val);
+        linkIndexes(node, Indexes());
+    } catch(...) {
+        unlinkInsertion(node);
+        nodes.destroy(node);
+        --size;
+        throw;
+    }
+}
+
+// Check if the list is empty
+template<typename T, typename... Index>
+bool FrankensteinMultiList<T, Index...>::empty() const {
+    return size == 0;
+}
+
+// Get the current size of the list
+template<typename T, typename... Index>
+std::size_t FrankensteinMultiList<T, Index...>::getSize() const {
+    return size;
+}
+
+// Get the memory resource the nodes come from
+template<typename T, typename... Index>
+std::pmr::memory_resource* FrankensteinMultiList<T, Index...>::getMemoryResource() const {
+    return nodes.resource();
+}
+
+// Exchange the contents of two lists
+template<typename T, typename... Index>
+void FrankensteinMultiList<T, Index...>::swap(FrankensteinMultiList &oth) noexcept {
+    using std::swap;
+    nodes.swap(oth.nodes);
+    swap(head, oth.head);
+    swap(tail, oth.tail);
+    swap(ends, oth.ends);
+    swap(size, oth.size);
+}
+
+// First element with the key in the order of index I
+template<typename T, typename... Index>
+template<std::size_t I>
+typename FrankensteinMultiList<T, Index...>::NodeType* FrankensteinMultiList<T, Index...>::find(const key_type<I> &k) const {
+    NodeType* found = lowerBound<I>(k);
+    return (found != nullptr && !less<I>(k, key<I>(found->val))) ? found : nullptr;
+}
+
+// Check whether an element has the key
+template<typename T, typename... Index>
+template<std::size_t I>
+bool FrankensteinMultiList<T, Index...>::contains(const key_type<I> &k) const {
+    return find<I>(k) != nullptr;
+}
+
+// Count the elements with the key, they are adjacent in the index
+template<typename T, typename... Index>
+template<std::size_t I>
+std::size_t FrankensteinMultiList<T, Index...>::count(const key_type<I> &k) const {
+    std::size_t found = 0;
+    for(NodeType* curr = find<I>(k); curr != nullptr && !less<I>(k, key<I>(curr->val)); curr = curr->sorted[I].greater) {
+        ++found;
+    }
+    return found;
+}
+
+// Remove every element with the key, walking only the matches after the first
+template<typename T, typename... Index>
+template<std::size_t I>
+void FrankensteinMultiList<T, Index...>::remove(const key_type<I> &k) {
+    NodeType* curr = find<I>(k);
+    while(curr != nullptr && !less<I>(k, key<I>(curr->val))) {
+        NodeType* next = curr->sorted[I].greater;
+        destroyNode(curr);
+        curr = next;
+    }
+}
+
+// Element with the smallest key of index I
+template<typename T, typename... Index>
+template<std::size_t I>
+typename FrankensteinMultiList<T, Index...>::NodeType* FrankensteinMultiList<T, Index...>::lowest() const {
+    return ends[I].lowest;
+}
+
+// Element with the largest key of index I
+template<typename T, typename... Index>
+template<std::size_t I>
+typename FrankensteinMultiList<T, Index...>::NodeType* FrankensteinMultiList<T, Index...>::highest() const {
+    return ends[I].highest;
+}
+
+// Iterator constructor
+template<typename T, typename... Index>
+FrankensteinMultiList<T, Index...>::Iterator::Iterator(NodeType *node, std::size_t v, bool b)
+    :ptr(node), view(v), backwards(b)
+{
+}
+
+// Dereference operator for Iterator
+template<typename T, typename... Index>
+T& FrankensteinMultiList<T, Index...>::Iterator::operator*() {
+    if(!ptr) {
+        throw std::runtime_error("Dereferencing end iterator");
+    }
+    return ptr->val;
+}
+
+// Arrow operator for Iterator
+template<typename T, typename... Index>
+T* FrankensteinMultiList<T, Index...>::Iterator::operator->() {
+    if(!ptr) {
+        throw std::runtime_error("Dereferencing end iterator");
+    }
+    return &ptr->val;
+}
+
+// Pre-increment operator for Iterator
+template<typename T, typename... Index>
+typename FrankensteinMultiList<T, Index...>::Iterator& FrankensteinMultiList<T, Index...>::Iterator::operator++() {
+    if(ptr) {
+        if(view == insertion) {
+            ptr = backwards ? ptr->prev : ptr->next;
+        } else {
+            ptr = backwards ? ptr->sorted[view].lesser : ptr->sorted[view].greater;
+        }
+    }
+    return *this;
+}
+
+// Post-increment operator for Iterator
+template<typename T, typename... Index>
+typename FrankensteinMultiList<T, Index...>::Iterator FrankensteinMultiList<T, Index...>::Iterator::operator++(int) {
+    Iterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+// Equality operator for Iterator
+template<typename T, typename... Index>
+bool FrankensteinMultiList<T, Index...>::Iterator::operator==(const Iterator &oth) const {
+    return ptr == oth.ptr;
+}
+
+// Inequality operator for Iterator
+template<typename T, typename... Index>
+bool FrankensteinMultiList<T, Index...>::Iterator::operator!=(const Iterator &oth) const {
+    return ptr != oth.ptr;
+}
+
+// First element of the insertion order, or the smallest of an index
+template<typename T, typename... Index>
+typename FrankensteinMultiList<T, Index...>::Iterator FrankensteinMultiList<T, Index...>::begin(std::size_t view) {
+    return Iterator((view == insertion) ? head : ends.at(view).lowest, view);
+}
+
+// End iterator
+template<typename T, typename... Index>
+typename FrankensteinMultiList<T, Index...>::Iterator FrankensteinMultiList<T, Index...>::end(std::size_t view) {
+    return Iterator(nullptr, view);
+}
+
+// Last element of the insertion order, or the largest of an index
+template<typename T, typename... Index>
+typename FrankensteinMultiList<T, Index...>::Iterator FrankensteinMultiList<T, Index...>::rbegin(std::size_t view) {
+    return Iterator((view == insertion) ? tail : ends.at(view).highest, view, true);
+}
+
+// End iterator of a backwards walk
+template<typename T, typename... Index>
+typename FrankensteinMultiList<T, Index...>::Iterator FrankensteinMultiList<T, Index...>::rend(std::size_t view) {
+    return Iterator(nullptr, view, true);
+}
+
+// ConstIterator constructor
+template<typename T, typename... Index>
+FrankensteinMultiList<T, Index...>::ConstIterator::ConstIterator(const NodeType *node, std::size_t v, bool b)
+    :ptr(node), view(v), backwards(b)
+{
+}
+
+// Dereference operator for ConstIterator
+template<typename T, typename... Index>
+const T& FrankensteinMultiList<T, Index...>::ConstIterator::operator*() const {
+    if(!ptr) {
+        throw std::runtime_error("Dereferencing end iterator");
+    }
+    return ptr->val;
+}
+
+// Arrow operator for ConstIterator
+template<typename T, typename... Index>
+const T* FrankensteinMultiList<T, Index...>::ConstIterator::operator->() const {
+    if(!ptr) {
+        throw std::runtime_error("Dereferencing end iterator");
+    }
+    return &ptr->val;
+}
+
+// Pre-increment operator for ConstIterator
+template<typename T, typename... Index>
+typename FrankensteinMultiList<T, Index...>::ConstIterator& FrankensteinMultiList<T, Index...>::ConstIterator::operator++() {
+    if(ptr) {
+        if(view == insertion) {
+            ptr = backwards ? ptr->prev : ptr->next;
+        } else {
+            ptr = backwards ? ptr->sorted[view].lesser : ptr->sorted[view].greater;
+        }
+    }
+    return *this;
+}
+
+// Post-increment operator for ConstIterator
+template<typename T, typename... Index>
+typename FrankensteinMultiList<T, Index...>::ConstIterator FrankensteinMultiList<T, Index...>::ConstIterator::operator++(int) {
+    ConstIterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+// Equality operator for ConstIterator
+template<typename T, typename... Index>
+bool FrankensteinMultiList<T, Index...>::ConstIterator::operator==(const ConstIterator &oth) const {
+    return ptr == oth.ptr;
+}
+
+// Inequality operator for ConstIterator
+template<typename T, typename... Index>
+bool FrankensteinMultiList<T, Index...>::ConstIterator::operator!=(const ConstIterator &oth) const {
+    return ptr != oth.ptr;
+}
+
+// Const begin iterator of a view
+template<typename T, typename... Index>
+typename FrankensteinMultiList<T, Index...>::ConstIterator FrankensteinMultiList<T, Index...>::cbegin(std::size_t view) const {
+    return ConstIterator((view == insertion) ? head : ends.at(view).lowest, view);
+}
+
+// Const end iterator
+template<typename T, typename... Index>
+typename FrankensteinMultiList<T, Index...>::ConstIterator FrankensteinMultiList<T, Index...>::cend(std::size_t view) const {
+    return ConstIterator(nullptr, view);
+}
+
+// Const backwards begin iterator of a view
+template<typename T, typename... Index>
+typename FrankensteinMultiList<T, Index...>::ConstIterator FrankensteinMultiList<T, Index...>::crbegin(std::size_t view) const {
+    return ConstIterator((view == insertion) ? tail : ends.at(view).highest, view, true);
+}
+
+// Const end iterator of a backwards walk
+template<typename T, typename... Index>
+typename FrankensteinMultiList<T, Index...>::ConstIterator FrankensteinMultiList<T, Index...>::crend(std::size_t view) const {
+    return ConstIterator(nullptr, view, true);
+}
+
+// Swap two multi-lists
+template<typename T, typename... Index>
+void swap(FrankensteinMultiList<T, Index...> &first, FrankensteinMultiList<T, Index...> &second) noexcept {
+    first.swap(second);
+}
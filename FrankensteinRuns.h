@@ -0,0 +1,124 @@
+#ifndef FRANKENSTEIN_S_LIST_FRANKENSTEINRUNS_H
+#define FRANKENSTEIN_S_LIST_FRANKENSTEINRUNS_H
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Equal-key runs of the sorted chain, kept by lists with EqualRuns in their policy. Equal
+// values are adjacent in the ascending chain; a run is one such group, described by its
+// first and last node and its length. The runs are chained in ascending order themselves,
+// so a search steps from value to value instead of from node to node. Every node holds the
+// index of its run's entry in the table.
+namespace frankenstein_runs {
+    constexpr std::uint32_t none = UINT32_MAX;// No run
+
+    template<typename Link>
+    struct Run {
+        Link head;// First node of the run in ascending order
+        Link last;// Last node of the run in ascending order
+        std::size_t count;// Nodes in the run
+        std::uint32_t lesser;// Run of the next smaller value, none for the smallest
+        std::uint32_t greater;// Run of the next larger value, none for the largest; the next free entry once freed
+    };
+
+    // Runs of one list. Freed entries are reused before the table grows.
+    template<typename Link>
+    class Table {
+    public:
+        Run<Link>& operator[](std::uint32_t run) noexcept {
+            return entries[run];
+        }
+        const Run<Link>& operator[](std::uint32_t run) const noexcept {
+            return entries[run];
+        }
+
+        std::uint32_t first() const noexcept {// Run of the smallest value, none without nodes
+            return smallest;
+        }
+        std::uint32_t last() const noexcept {// Run of the largest value, none without nodes
+            return largest;
+        }
+        std::size_t runs() const noexcept {// Runs in use, the number of distinct values
+            return live;
+        }
+        std::size_t bytes() const noexcept {// Heap bytes of the table
+            return entries.capacity() * sizeof(Run<Link>);
+        }
+
+        // Make room for the given number of runs beyond those in use, so that opening them cannot throw
+        void reserve(std::size_t more) {
+            if(entries.capacity() - live >= more) return;
+            entries.reserve(std::max(live + more, entries.capacity() * 2));
+        }
+
+        // Start a run of one node right after the given run, or in front of every run with none
+        std::uint32_t open(Link node, std::uint32_t after) {
+            std::uint32_t run;
+            if(freed != none) {
+                run = freed;
+                freed = entries[run].greater;
+            } else {
+                run = static_cast<std::uint32_t>(entries.size());
+                entries.emplace_back();
+            }
+            std::uint32_t before = (after == none) ? smallest : entries[after].greater;
+            entries[run] = Run<Link>{node, node, 1, after, before};
+            if(after != none) entries[after].greater = run; else smallest = run;
+            if(before != none) entries[before].lesser = run; else largest = run;
+            ++live;
+            return run;
+        }
+
+        // Take a run out of the chain of runs and free its entry
+        void close(std::uint32_t run) noexcept {
+            Run<Link>& r = entries[run];
+            if(r.lesser != none) entries[r.lesser].greater = r.greater; else smallest = r.greater;
+            if(r.greater != none) entries[r.greater].lesser = r.lesser; else largest = r.lesser;
+            r.count = 0;
+            r.greater = freed;
+            freed = run;
+            --live;
+        }
+
+        // Forget every run, keeping the memory for the next ones
+        void clear() noexcept {
+            entries.clear();
+            smallest = none;
+            largest = none;
+            freed = none;
+            live = 0;
+        }
+
+        // Apply a function to the head and last link of every run in use
+        template<typename Remap>
+        void remap(Remap &&remap) {
+            for(std::uint32_t run = smallest; run != none; run = entries[run].greater) {
+                entries[run].head = remap(entries[run].head);
+                entries[run].last = remap(entries[run].last);
+            }
+        }
+
+        void swap(Table &oth) noexcept {
+            using std::swap;
+            entries.swap(oth.entries);
+            swap(smallest, oth.smallest);
+            swap(largest, oth.largest);
+            swap(freed, oth.freed);
+            swap(live, oth.live);
+        }
+    private:
+        std::vector<Run<Link>> entries;
+        std::uint32_t smallest = none;
+        std::uint32_t largest = none;
+        std::uint32_t freed = none;// Most recently freed entry, the free entries are chained through greater
+        std::size_t live = 0;
+    };
+
+    // Stand-in for the table in lists without runs
+    struct Ungrouped {
+    };
+}
+
+#endif //FRANKENSTEIN_S_LIST_FRANKENSTEINRUNS_H
@@ -0,0 +1,51 @@
+#ifndef FRANKENSTEIN_S_LIST_FRANKENSTEINSERIALIZER_H
+#define FRANKENSTEIN_S_LIST_FRANKENSTEINSERIALIZER_H
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+// Value format of FrankensteinList::save()/load() for types that are not
+// trivially copyable (those are stored as their raw bytes). Specialize it as
+//     template<> struct FrankensteinSerializer<MyType> {
+//         static void write(std::ostream&, const MyType&);
+//         static MyType read(std::istream&);// throw when the stream holds no valid value
+//     };
+template<typename T, typename = void>
+struct FrankensteinSerializer;
+
+// Strings: a 64-bit length followed by the characters
+template<typename CharT, typename Traits, typename Alloc>
+struct FrankensteinSerializer<std::basic_string<CharT, Traits, Alloc>> {
+    static_assert(std::is_trivially_copyable<CharT>::value, "String characters are stored as their raw bytes");
+    using String = std::basic_string<CharT, Traits, Alloc>;
+
+    static void write(std::ostream &os, const String &str) {
+        std::uint64_t length = str.size();
+        os.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        os.write(reinterpret_cast<const char*>(str.data()), static_cast<std::streamsize>(length * sizeof(CharT)));
+    }
+
+    static String read(std::istream &is) {
+        std::uint64_t length = 0;
+        if(!is.read(reinterpret_cast<char*>(&length), sizeof(length))) {
+            throw std::runtime_error("Truncated string in list snapshot.");
+        }
+        // Grow with the data actually read, a corrupt length must not allocate blindly
+        String str;
+        CharT chunk[256];
+        while(length) {
+            std::uint64_t part = (length < 256) ? length : 256;
+            if(!is.read(reinterpret_cast<char*>(chunk), static_cast<std::streamsize>(part * sizeof(CharT)))) {
+                throw std::runtime_error("Truncated string in list snapshot.");
+            }
+            str.append(chunk, static_cast<std::size_t>(part));
+            length -= part;
+        }
+        return str;
+    }
+};
+
+#endif //FRANKENSTEIN_S_LIST_FRANKENSTEINSERIALIZER_H
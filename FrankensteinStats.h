@@ -0,0 +1,22 @@
+#ifndef FRANKENSTEIN_S_LIST_FRANKENSTEINSTATS_H
+#define FRANKENSTEIN_S_LIST_FRANKENSTEINSTATS_H
+#include <cstdint>
+
+// Work counters of a list with CountingStats in its policy. They add up from the last
+// resetStats(), so resetting before a call shows what that call cost.
+struct ListStats {
+    std::uint64_t comparisons = 0;// Value comparisons of sorted insertion, set algebra and the value lookups
+    std::uint64_t nextHops = 0;// Links followed along the insertion chain
+    std::uint64_t prevHops = 0;// Links followed backwards along the insertion chain
+    std::uint64_t greaterHops = 0;// Links followed along the ascending chain
+    std::uint64_t lesserHops = 0;// Links followed along the descending chain
+    std::uint64_t allocations = 0;// Nodes created
+    std::uint64_t frees = 0;// Nodes destroyed
+    std::uint64_t sortedInsertions = 0;// Nodes put into the sorted chain one at a time
+};
+
+// Stand-in member of lists that count nothing
+struct UncountedStats {
+};
+
+#endif //FRANKENSTEIN_S_LIST_FRANKENSTEINSTATS_H
@@ -0,0 +1,264 @@
+#ifndef FRANKENSTEIN_S_LIST_FRANKENSTEINTEXT_H
+#define FRANKENSTEIN_S_LIST_FRANKENSTEINTEXT_H
+#include <algorithm>
+#include <charconv>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <istream>
+#include <locale>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Text input of FrankensteinList::from_stream(): whitespace-separated numbers read in
+// large blocks and parsed with std::from_chars. Text output of the print functions:
+// values formatted with std::to_chars into a per-thread buffer written in large pieces.
+namespace frankenstein_text {
+    constexpr std::size_t blockBytes = 1 << 20;// Bytes read from the stream at a time
+    constexpr std::size_t batchValues = 1 << 14;// Values handed from the parser to the builder at a time
+    constexpr std::size_t queueDepth = 8;// Parsed batches waiting for the builder at most
+    constexpr std::size_t maxToken = 512;// Longest number accepted, anything longer is corrupt input
+    constexpr std::size_t formatBytes = 1 << 16;// Formatted text handed on at a time
+    constexpr std::size_t maxNumber = 128;// Room std::to_chars needs for any arithmetic value
+
+    inline bool isSpace(char c) {
+        return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\f' || c == '\v';
+    }
+
+    // Parse the numbers in [first, last), passing each to sink. Unless the block is the
+    // final one, a number touching last may continue in the next block; it is left
+    // unparsed and the return value is where it starts.
+    template<typename T, typename Sink>
+    const char* parseNumbers(const char *first, const char *last, bool final, Sink &&sink) {
+        const char* p = first;
+        for(;;) {
+            while(p != last && isSpace(*p)) ++p;
+            if(p == last) return p;
+
+            const char* token = p;
+            while(p != last && !isSpace(*p)) ++p;
+            if(p == last && !final) return token;
+
+            T val;
+            auto [end, ec] = std::from_chars(token, p, val);
+            if(ec != std::errc() || end != p) {
+                throw std::runtime_error("Invalid number in list input: " + std::string(token, p));
+            }
+            if constexpr (std::is_floating_point<T>::value) {
+                if(val != val) {
+                    throw std::runtime_error("NaN in list input cannot be sorted.");
+                }
+            }
+            sink(val);
+        }
+    }
+
+    // Bounded hand-over of value batches from one producer thread to one consumer. Drained
+    // batches go back to the producer, so the pipeline allocates only while it fills up.
+    template<typename T>
+    class BatchChannel {
+    public:
+        // Hand a batch to the consumer, waiting while the queue is full; false once the consumer gave up
+        bool push(std::vector<T> &&batch) {
+            std::unique_lock<std::mutex> guard(lock);
+            changed.wait(guard, [this] { return full.size() < queueDepth || cancelled; });
+            if(cancelled) return false;
+            full.push_back(std::move(batch));
+            changed.notify_all();
+            return true;
+        }
+
+        // Take the next batch; false at the end of the input, rethrows a failure of the producer
+        bool pop(std::vector<T> &batch) {
+            std::unique_lock<std::mutex> guard(lock);
+            changed.wait(guard, [this] { return !full.empty() || done; });
+            if(full.empty()) {
+                if(error) std::rethrow_exception(error);
+                return false;
+            }
+            batch = std::move(full.front());
+            full.pop_front();
+            changed.notify_all();
+            return true;
+        }
+
+        // A drained batch to refill, or a new one
+        std::vector<T> spare() {
+            std::lock_guard<std::mutex> guard(lock);
+            std::vector<T> batch;
+            if(!empty.empty()) {
+                batch = std::move(empty.back());
+                empty.pop_back();
+            }
+            batch.clear();
+            batch.reserve(batchValues);
+            return batch;
+        }
+
+        // Give a drained batch back
+        void recycle(std::vector<T> &&batch) {
+            std::lock_guard<std::mutex> guard(lock);
+            empty.push_back(std::move(batch));
+        }
+
+        // The producer is done, with the failure that stopped it if any
+        void finish(std::exception_ptr failure = nullptr) {
+            std::lock_guard<std::mutex> guard(lock);
+            done = true;
+            error = failure;
+            changed.notify_all();
+        }
+
+        // The consumer gives up, a waiting producer returns
+        void cancel() {
+            std::lock_guard<std::mutex> guard(lock);
+            cancelled = true;
+            changed.notify_all();
+        }
+    private:
+        std::mutex lock;
+        std::condition_variable changed;
+        std::deque<std::vector<T>> full;// Parsed batches in input order
+        std::vector<std::vector<T>> empty;// Drained batches
+        bool done = false;
+        bool cancelled = false;
+        std::exception_ptr error;
+    };
+
+    // Read a stream block by block and hand the parsed values over in batches.
+    // Runs on the producer thread and always finishes the channel.
+    template<typename T>
+    void produce(std::istream &is, BatchChannel<T> &channel) {
+        try {
+            std::vector<char> block(maxToken + blockBytes);
+            std::size_t carry = 0;// Start of a number cut by the previous block
+            std::vector<T> batch = channel.spare();
+            bool open = true;
+            auto sink = [&](T val) {
+                batch.push_back(val);
+                if(batch.size() == batchValues) {
+                    open = open && channel.push(std::move(batch));
+                    batch = channel.spare();
+                }
+            };
+
+            bool final = false;
+            while(!final && open) {
+                is.read(block.data() + carry, static_cast<std::streamsize>(blockBytes));
+                std::size_t got = static_cast<std::size_t>(is.gcount());
+                if(is.bad()) {
+                    throw std::runtime_error("Failed to read list input.");
+                }
+                final = !is;
+                const char* end = block.data() + carry + got;
+                const char* rest = parseNumbers<T>(block.data(), end, final, sink);
+                carry = static_cast<std::size_t>(end - rest);
+                if(carry > maxToken) {
+                    throw std::runtime_error("Invalid number in list input: token too long.");
+                }
+                std::copy(rest, end, block.data());
+            }
+            if(open && !batch.empty()) {
+                channel.push(std::move(batch));
+            }
+            channel.finish();
+        } catch(...) {
+            channel.finish(std::current_exception());
+        }
+    }
+    // Whether a stream prints values of type T exactly as std::to_chars does: integers
+    // without base, sign, width or digit grouping settings
+    template<typename T>
+    bool plainStream(const std::ostream &os) {
+        if constexpr (std::is_integral<T>::value && !std::is_same<T, bool>::value && !std::is_same<T, char>::value
+                      && !std::is_same<T, signed char>::value && !std::is_same<T, unsigned char>::value
+                      && !std::is_same<T, wchar_t>::value && !std::is_same<T, char16_t>::value
+                      && !std::is_same<T, char32_t>::value) {
+            return (os.flags() & (std::ios::basefield | std::ios::showpos)) == std::ios::dec && os.width() == 0
+                   && std::use_facet<std::numpunct<char>>(os.getloc()).grouping().empty();
+        } else {
+            return false;
+        }
+    }
+
+    // Output buffer of the formatting functions. Each thread reuses one buffer across calls;
+    // a call made while it is in use, from inside an output iterator say, gets its own.
+    class FormatBuffer {
+    public:
+        FormatBuffer()
+                :borrowed(!busy()), text(borrowed ? shared() : own), used(0)
+        {
+            if(borrowed) busy() = true;
+            if(text.size() < formatBytes + maxNumber) text.resize(formatBytes + maxNumber);
+        }
+        ~FormatBuffer() {
+            if(borrowed) busy() = false;
+        }
+        FormatBuffer(const FormatBuffer&) = delete;
+        FormatBuffer& operator=(const FormatBuffer&) = delete;
+
+        // Format one value: std::to_chars for arithmetic types, operator<< for the rest
+        template<typename T>
+        void value(const T &val) {
+            if constexpr (std::is_same<T, bool>::value) {
+                text[used++] = val ? '1' : '0';
+            } else if constexpr (std::is_same<T, char>::value || std::is_same<T, signed char>::value || std::is_same<T, unsigned char>::value) {
+                text[used++] = static_cast<char>(val);
+            } else if constexpr (std::is_same<T, wchar_t>::value || std::is_same<T, char16_t>::value || std::is_same<T, char32_t>::value) {
+                value(static_cast<std::uint_least32_t>(val));
+            } else if constexpr (std::is_arithmetic<T>::value) {
+                if(used + maxNumber > text.size()) text.resize(used + maxNumber);
+                used = static_cast<std::size_t>(std::to_chars(&text[used], &text[used] + maxNumber, val).ptr - text.data());
+            } else {
+                thread_local std::ostringstream os;
+                os.str(std::string());
+                os << val;
+                append(os.str());
+            }
+        }
+
+        // Append text as it is
+        void append(std::string_view piece) {
+            if(used + piece.size() > text.size()) text.resize(used + piece.size() + maxNumber);
+            piece.copy(&text[used], piece.size());
+            used += piece.size();
+        }
+
+        // Whether the buffer should be handed on
+        bool full() const {
+            return used >= formatBytes;
+        }
+
+        // Hand the formatted text on and start over
+        std::string_view take() {
+            std::string_view taken(text.data(), used);
+            used = 0;
+            return taken;
+        }
+    private:
+        static std::string& shared() {
+            thread_local std::string buffer;
+            return buffer;
+        }
+        static bool& busy() {
+            thread_local bool inUse = false;
+            return inUse;
+        }
+
+        bool borrowed;// Whether this is the thread's shared buffer
+        std::string own;// Buffer of a nested call
+        std::string& text;
+        std::size_t used;// Bytes formatted so far
+    };
+}
+
+#endif //FRANKENSTEIN_S_LIST_FRANKENSTEINTEXT_H
@@ -0,0 +1,288 @@
+#ifndef FRANKENSTEIN_S_LIST_FRANKENSTEINTIMING_H
+#define FRANKENSTEIN_S_LIST_FRANKENSTEINTIMING_H
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Latency histograms of the lists with OperationTiming in their policy. Every public call is
+// timed and counted in a log-linear histogram of its operation: 16 buckets per power of two
+// of nanoseconds, so a bucket is at most 6.25% wide. Each thread counts into its own shard
+// and the shards are added up when read. The histograms are process-wide, shared by every
+// timed list whatever its value type.
+namespace frankenstein_timing {
+    enum class Operation : std::uint8_t {
+        push_back, push_front, insertAt, pop_front, pop_back, erase, eraseRange, remove, unique,
+        reverse, sort, resize, emplace_front, splice, assign, merge, mergeAll,
+        setUnion, setIntersection, setDifference, setSymmetricDifference,
+        getNodeAt, contains, count, findFirstInserted, copy, compact, save, load, print,
+        operations// Number of operations
+    };
+
+    constexpr std::size_t operations = static_cast<std::size_t>(Operation::operations);
+
+    // Label value of an operation in the exported metrics, the name of the member it stands for
+    inline const char* name(Operation op) {
+        static constexpr const char* names[operations] = {
+            "push_back", "push_front", "insertAt", "pop_front", "pop_back", "erase", "erase_range", "remove", "unique",
+            "reverse", "sort", "resize", "emplace_front", "splice", "assign", "merge", "merge_all",
+            "set_union_with", "set_intersection_with", "set_difference_with", "set_symmetric_difference_with",
+            "getNodeAt", "contains", "count", "find_first_inserted", "copy", "compact", "save", "load", "print"
+        };
+        return names[static_cast<std::size_t>(op)];
+    }
+
+    constexpr unsigned subBits = 4;// 2^subBits buckets per power of two
+    constexpr std::uint64_t subBuckets = std::uint64_t(1) << subBits;
+    constexpr std::uint64_t maxNanoseconds = (std::uint64_t(1) << 36) - 1;// About 69 s, longer calls are counted here
+
+    // Bucket of a duration: exact below 16 ns, then 16 per power of two
+    constexpr std::size_t bucketOf(std::uint64_t ns) {
+        if(ns > maxNanoseconds) ns = maxNanoseconds;
+        if(ns < subBuckets) return static_cast<std::size_t>(ns);
+#if defined(__GNUC__) || defined(__clang__)
+        unsigned shift = 63u - static_cast<unsigned>(__builtin_clzll(ns)) - subBits;
+#else
+        unsigned shift = 0;
+        for(std::uint64_t rest = ns >> (subBits + 1); rest; rest >>= 1) {
+            ++shift;
+        }
+#endif
+        return static_cast<std::size_t>((shift + 1) * subBuckets + (ns >> shift) - subBuckets);
+    }
+
+    // Longest duration counted in a bucket
+    constexpr std::uint64_t bucketHighest(std::size_t bucket) {
+        if(bucket < subBuckets) return bucket;
+        std::uint64_t shift = bucket / subBuckets - 1;
+        std::uint64_t lowest = (bucket % subBuckets + subBuckets) << shift;
+        return lowest + (std::uint64_t(1) << shift) - 1;
+    }
+
+    constexpr std::size_t buckets = bucketOf(maxNanoseconds) + 1;
+
+    // Durations of one operation, added up over the threads
+    struct Histogram {
+        std::array<std::uint64_t, buckets> counts{};
+        std::uint64_t total = 0;// Calls
+        std::uint64_t sum = 0;// Nanoseconds over all calls
+
+        // Duration not exceeded by the given fraction of the calls, to the bucket's precision
+        std::uint64_t quantile(double q) const {
+            if(total == 0) return 0;
+            double rank = q * static_cast<double>(total);
+            std::uint64_t seen = 0;
+            for(std::size_t b = 0; b < buckets; ++b) {
+                seen += counts[b];
+                if(seen > 0 && static_cast<double>(seen) >= rank) return bucketHighest(b);
+            }
+            return maxNanoseconds;
+        }
+    };
+
+    // Counts of one thread. Only the owning thread writes, so relaxed loads and stores suffice
+    // and readers see every count eventually.
+    struct Shard {
+        std::atomic<std::uint64_t> counts[operations][buckets] = {};
+        std::atomic<std::uint64_t> totals[operations] = {};
+        std::atomic<std::uint64_t> sums[operations] = {};
+        std::atomic<bool> leased{false};// Whether a live thread counts here
+
+        void record(Operation op, std::uint64_t ns) {
+            std::size_t o = static_cast<std::size_t>(op);
+            bump(counts[o][bucketOf(ns)], 1);
+            bump(totals[o], 1);
+            bump(sums[o], ns);
+        }
+
+        static void bump(std::atomic<std::uint64_t> &counter, std::uint64_t by) {
+            counter.store(counter.load(std::memory_order_relaxed) + by, std::memory_order_relaxed);
+        }
+    };
+
+    // Receiver of the begin and end of every timed call, for attaching a tracer. Only the
+    // outermost call of a thread is reported, as it is the only one timed.
+    class Tracer {
+    public:
+        virtual ~Tracer() = default;
+        virtual void begin(Operation, const void* list) = 0;// Called before the clock starts
+        virtual void end(Operation, const void* list, std::uint64_t ns) = 0;// Called after the clock stops, also when the call throws
+    };
+
+    // The shards of every thread that ever timed a call. A thread leases a shard on its first
+    // call and gives it back when it exits; the next new thread counts on into it.
+    class Registry {
+    public:
+        static Registry& instance() {
+            static Registry registry;
+            return registry;
+        }
+
+        // The shard of the calling thread
+        Shard& local() {
+            struct Lease {
+                Shard* shard = nullptr;
+                ~Lease() {
+                    if(shard) shard->leased.store(false, std::memory_order_release);
+                }
+            };
+            thread_local Lease lease;
+            if(!lease.shard) lease.shard = &acquire();
+            return *lease.shard;
+        }
+
+        // The counts of an operation, added up over the shards
+        Histogram histogram(Operation op) const {
+            std::lock_guard<std::mutex> guard(lock);
+            std::size_t o = static_cast<std::size_t>(op);
+            Histogram merged;
+            for(const auto& shard : shards) {
+                for(std::size_t b = 0; b < buckets; ++b) {
+                    merged.counts[b] += shard->counts[o][b].load(std::memory_order_relaxed);
+                }
+                merged.total += shard->totals[o].load(std::memory_order_relaxed);
+                merged.sum += shard->sums[o].load(std::memory_order_relaxed);
+            }
+            return merged;
+        }
+
+        // Zero every count; calls in progress on other threads may still land in the old counts
+        void reset() {
+            std::lock_guard<std::mutex> guard(lock);
+            for(const auto& shard : shards) {
+                for(std::size_t o = 0; o < operations; ++o) {
+                    for(auto& count : shard->counts[o]) count.store(0, std::memory_order_relaxed);
+                    shard->totals[o].store(0, std::memory_order_relaxed);
+                    shard->sums[o].store(0, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        std::atomic<Tracer*> tracer{nullptr};
+    private:
+        Shard& acquire() {
+            std::lock_guard<std::mutex> guard(lock);
+            for(const auto& shard : shards) {
+                bool free = false;
+                if(shard->leased.compare_exchange_strong(free, true, std::memory_order_acquire)) return *shard;
+            }
+            shards.push_back(std::make_unique<Shard>());
+            shards.back()->leased.store(true, std::memory_order_relaxed);
+            return *shards.back();
+        }
+
+        mutable std::mutex lock;
+        std::vector<std::unique_ptr<Shard>> shards;
+    };
+
+    // The histogram of an operation over all threads
+    inline Histogram histogram(Operation op) {
+        return Registry::instance().histogram(op);
+    }
+
+    // Zero every histogram
+    inline void reset() {
+        Registry::instance().reset();
+    }
+
+    // Attach a tracer, or detach it with null. It must stay alive until it is replaced and every call it saw begin has ended.
+    inline void setTracer(Tracer *tracer) {
+        Registry::instance().tracer.store(tracer, std::memory_order_release);
+    }
+
+    // Write every operation called so far as a Prometheus histogram in the text exposition format.
+    // The le bounds are powers of two of nanoseconds, where the buckets above line up exactly.
+    inline void writePrometheus(std::ostream &os) {
+        constexpr unsigned lowestBound = 6;// 64 ns
+        constexpr unsigned highestBound = 36;
+        char number[32];
+        auto seconds = [&](std::uint64_t ns) {
+            return std::string(number, std::to_chars(number, number + sizeof(number), static_cast<double>(ns) * 1e-9).ptr);
+        };
+
+        os << "# HELP frankenstein_list_operation_seconds Latency of FrankensteinList calls.\n"
+           << "# TYPE frankenstein_list_operation_seconds histogram\n";
+        for(std::size_t o = 0; o < operations; ++o) {
+            Operation op = static_cast<Operation>(o);
+            Histogram h = histogram(op);
+            if(h.total == 0) continue;
+            std::string label = std::string("{op=\"") + name(op) + "\"";
+
+            std::uint64_t below = 0;
+            std::size_t b = 0;
+            for(unsigned k = lowestBound; k <= highestBound; ++k) {
+                std::uint64_t bound = std::uint64_t(1) << k;
+                for(; b < buckets && bucketHighest(b) < bound; ++b) below += h.counts[b];
+                os << "frankenstein_list_operation_seconds_bucket" << label << ",le=\"" << seconds(bound) << "\"} " << below << '\n';
+            }
+            os << "frankenstein_list_operation_seconds_bucket" << label << ",le=\"+Inf\"} " << h.total << '\n'
+               << "frankenstein_list_operation_seconds_sum" << label << "} " << seconds(h.sum) << '\n'
+               << "frankenstein_list_operation_seconds_count" << label << "} " << h.total << '\n';
+        }
+        if(!os) {
+            throw std::runtime_error("Failed to write list metrics.");
+        }
+    }
+
+    // Write the metrics to a file, replacing it
+    inline void writePrometheus(const std::string &path) {
+        std::ofstream os(path, std::ios::trunc);
+        if(!os) {
+            throw std::runtime_error("Failed to open list metrics file: " + path);
+        }
+        writePrometheus(os);
+    }
+
+    // Times a public call from construction to destruction. Calls a timed call makes, on this or
+    // another list, run inside it and are not timed on their own. Empty when timing is off.
+    template<bool enabled>
+    class Scope {
+    public:
+        Scope(Operation, const void*) {}
+    };
+
+    template<>
+    class Scope<true> {
+    public:
+        Scope(Operation op, const void *list)
+                :op(op), list(list), outermost(depth()++ == 0)
+        {
+            if(!outermost) return;
+            tracer = Registry::instance().tracer.load(std::memory_order_acquire);
+            if(tracer) tracer->begin(op, list);
+            start = std::chrono::steady_clock::now();
+        }
+        ~Scope() {
+            --depth();
+            if(!outermost) return;
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+            std::uint64_t ns = static_cast<std::uint64_t>(elapsed);
+            Registry::instance().local().record(op, ns);
+            if(tracer) tracer->end(op, list, ns);
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    private:
+        static unsigned& depth() {
+            thread_local unsigned calls = 0;
+            return calls;
+        }
+
+        Operation op;
+        const void* list;
+        bool outermost;// Whether no other timed call of this thread is in progress
+        Tracer* tracer = nullptr;
+        std::chrono::steady_clock::time_point start;
+    };
+}
+
+#endif //FRANKENSTEIN_S_LIST_FRANKENSTEINTIMING_H
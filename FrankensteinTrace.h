@@ -0,0 +1,130 @@
+#ifndef FRANKENSTEIN_S_LIST_FRANKENSTEINTRACE_H
+#define FRANKENSTEIN_S_LIST_FRANKENSTEINTRACE_H
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+// Operation trace format of RecordingFrankensteinList: a header, a snapshot of the list
+// when recording started, then one record per call. A record is a tag byte followed by
+// the arguments of the call: values as in snapshots, positions and counts as LEB128
+// varints, so that the common small positions take a byte or two.
+namespace frankenstein_trace {
+    constexpr char magic[8] = {'F', 'R', 'K', 'L', 'T', 'R', 'C', '\0'};
+    constexpr std::uint32_t version = 1;
+    constexpr std::uint32_t byteOrder = 0x01020304;
+
+    // Record tags
+    enum class Op : std::uint8_t {
+        push_back = 1,// value
+        push_front,// value
+        insertAt,// value, position
+        pop_front,
+        pop_back,
+        erase,// position
+        eraseRange,// position, count
+        remove,// value
+        unique,
+        reverse,
+        sort,
+        resize,// count
+        assign,// value, count
+        contains,// value
+        count,// value
+        getNodeAt,// position
+        scan,// order: 0 insertion, 1 ascending, 2 descending
+        end// One past the last tag
+    };
+
+    // Name of the member a record stands for
+    inline const char* name(Op op) {
+        static constexpr const char* names[] = {
+            "", "push_back", "push_front", "insertAt", "pop_front", "pop_back", "erase", "erase_range", "remove",
+            "unique", "reverse", "sort", "resize", "assign", "contains", "count", "getNodeAt", "scan"
+        };
+        return names[static_cast<std::size_t>(op)];
+    }
+
+    // Value types a trace can say it holds, so that a replay tool can pick the matching list
+    enum class ValueKind : std::uint8_t {
+        other = 0,
+        signedInteger,
+        unsignedInteger,
+        floatingPoint,
+        string
+    };
+
+    template<typename T>
+    constexpr ValueKind valueKind() {
+        if constexpr (std::is_same<T, std::string>::value) return ValueKind::string;
+        else if constexpr (std::is_floating_point<T>::value) return ValueKind::floatingPoint;
+        else if constexpr (std::is_integral<T>::value && std::is_signed<T>::value) return ValueKind::signedInteger;
+        else if constexpr (std::is_integral<T>::value) return ValueKind::unsignedInteger;
+        else return ValueKind::other;
+    }
+
+    // Header of a trace file
+    struct Header {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t byteOrder;
+        std::uint32_t valueKind;// ValueKind of the values
+        std::uint32_t valueBytes;// sizeof of the values
+    };
+
+    // Write a trace header for values of type T
+    template<typename T>
+    void writeHeader(std::ostream &os) {
+        Header header{};
+        std::copy(magic, magic + 8, header.magic);
+        header.version = version;
+        header.byteOrder = byteOrder;
+        header.valueKind = static_cast<std::uint32_t>(valueKind<T>());
+        header.valueBytes = sizeof(T);
+        os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+
+    // Read and check a trace header, the value type is left to the caller
+    inline Header readHeader(std::istream &is) {
+        Header header;
+        if(!is.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+            throw std::runtime_error("Truncated list trace header.");
+        }
+        if(!std::equal(magic, magic + 8, header.magic) || header.version != version || header.byteOrder != byteOrder) {
+            throw std::runtime_error("Not a list trace or unsupported version.");
+        }
+        return header;
+    }
+
+    // Write a position or count, seven bits per byte with the high bit marking more to come
+    inline void writeNumber(std::ostream &os, std::uint64_t number) {
+        char bytes[10];
+        int used = 0;
+        do {
+            bytes[used] = static_cast<char>(number & 0x7f);
+            number >>= 7;
+            if(number) bytes[used] = static_cast<char>(bytes[used] | 0x80);
+            ++used;
+        } while(number);
+        os.write(bytes, used);
+    }
+
+    // Read a position or count
+    inline std::uint64_t readNumber(std::istream &is) {
+        std::uint64_t number = 0;
+        for(unsigned shift = 0; shift < 64; shift += 7) {
+            int byte = is.get();
+            if(byte == std::char_traits<char>::eof()) {
+                throw std::runtime_error("Truncated list trace record.");
+            }
+            number |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+            if(!(byte & 0x80)) return number;
+        }
+        throw std::runtime_error("Corrupt number in list trace.");
+    }
+}
+
+#endif //FRANKENSTEIN_S_LIST_FRANKENSTEINTRACE_H
@@ -0,0 +1,219 @@
+#ifndef FRANKENSTEIN_S_LIST_LISTPOLICY_H
+#define FRANKENSTEIN_S_LIST_LISTPOLICY_H
+#include "NodeStorage.h"
+
+// Link representations. A link policy names the type stored in the
+// next/prev/greater/lesser fields of a node and the storage that owns the nodes.
+
+// Raw Node* links, one heap allocation per node (the classic layout)
+struct PointerLinks {
+    template<typename N> using link_type = N*;
+    template<typename N> static constexpr link_type<N> null_link = nullptr;
+    template<typename N> using Storage = PointerNodeStorage<N>;
+};
+
+// 32-bit slot indices into an arena owned by the list, for lists under 4 billion nodes
+struct IndexLinks {
+    template<typename N> using link_type = std::uint32_t;
+    template<typename N> static constexpr link_type<N> null_link = ArenaNodeStorage<N>::null;
+    template<typename N> using Storage = ArenaNodeStorage<N>;
+};
+
+// 32-bit slot indices where the first Capacity nodes live inside the list object
+// and the rest spill into an arena, for lists that are usually small
+template<std::uint32_t Capacity>
+struct InlineLinks {
+    template<typename N> using link_type = std::uint32_t;
+    template<typename N> static constexpr link_type<N> null_link = UINT32_MAX;
+    template<typename N> using Storage = InlineNodeStorage<N, Capacity>;
+};
+
+// Chain sets. The insertion chain always has next and the sorted chain always has
+// greater; a chain set says whether the backward links exist as well. A missing
+// prev or lesser field disappears from Node and its upkeep from every mutator.
+// Backward steps are then found by walking forward from the front, and the
+// descending order is derived from the ascending chain when it is asked for.
+
+// next, prev, greater, lesser (the classic layout)
+struct FourWayChains {
+    static constexpr bool has_prev = true;
+    static constexpr bool has_lesser = true;
+};
+
+// next, prev, greater: insertion order both ways, sorted order ascending only
+struct AscendingChains {
+    static constexpr bool has_prev = true;
+    static constexpr bool has_lesser = false;
+};
+
+// next, greater: both orders forward only, two links per node
+struct ForwardAscendingChains {
+    static constexpr bool has_prev = false;
+    static constexpr bool has_lesser = false;
+};
+
+// next, greater, lesser: insertion order forward only, sorted order both ways
+struct ForwardSortedChains {
+    static constexpr bool has_prev = false;
+    static constexpr bool has_lesser = true;
+};
+
+// Jump hints. A node remembers the node a fixed number of hops ahead in each
+// chain, so a walk can prefetch that far ahead instead of waiting on every hop.
+// Walks refresh the hints as they go; a hint is only ever prefetched, never
+// followed, so a stale one costs a wasted prefetch and nothing else.
+
+// No hint fields, walks chase the links one hop at a time
+struct NoJumpHints {
+    static constexpr unsigned distance = 0;
+};
+
+// Hints Distance hops ahead in the insertion and the ascending chain
+template<unsigned Distance>
+struct JumpHints {
+    static_assert(Distance > 0, "JumpHints need a distance of at least one hop");
+    static constexpr unsigned distance = Distance;
+};
+
+// Content fingerprints. A fingerprinting list keeps hashes of its values in insertion
+// order and regardless of order up to date, so unequal lists are told apart without a walk.
+
+// No fingerprint, the hashes are computed on demand
+struct NoFingerprint {
+    static constexpr bool enabled = false;
+};
+
+// Fingerprint updated by every mutating member, needs std::hash<T>
+struct ContentFingerprint {
+    static constexpr bool enabled = true;
+};
+
+// Work counters. A counting list tallies comparisons, link hops per chain, node allocations
+// and frees and sorted insertions; without them the tallies compile to nothing.
+
+// No counters
+struct NoStats {
+    static constexpr bool enabled = false;
+};
+
+// Counters read with stats() and cleared with resetStats()
+struct CountingStats {
+    static constexpr bool enabled = true;
+};
+
+// Latency histograms, see FrankensteinTiming.h. A timed list reads the clock around every
+// public call; without them the timers compile to nothing.
+
+// No timing
+struct NoTiming {
+    static constexpr bool enabled = false;
+};
+
+// Every public call counted in the process-wide histogram of its operation
+struct OperationTiming {
+    static constexpr bool enabled = true;
+};
+
+// Equal-key runs, see FrankensteinRuns.h. A grouping list keeps the equal values of the
+// sorted chain together as runs with a length, so sorted insertions, searches, count and
+// remove step over whole runs instead of single nodes. Pays off when values repeat a lot.
+
+// No runs, the sorted chain is searched node by node
+struct NoRuns {
+    static constexpr bool enabled = false;
+};
+
+// Runs kept up to date by every mutating member, each node carries the index of its run
+struct EqualRuns {
+    static constexpr bool enabled = true;
+};
+
+// Hash index, see FrankensteinIndex.h. An indexed list maps every value to the nodes
+// holding it, so membership, counting and removal by value skip the chains entirely.
+
+// No index, values are searched along the sorted chain
+struct NoHashIndex {
+    static constexpr bool enabled = false;
+};
+
+// Index kept up to date by every mutating member, needs std::hash<T>; each node links to its equal neighbours
+struct HashIndex {
+    static constexpr bool enabled = true;
+};
+
+// Key prefixes, see FrankensteinKeyPrefix.h. A prefixed list caches a normalized prefix of
+// every value in its node, so sorted insertions, unique and remove compare two integers and
+// fall back to the values only when the prefixes tie.
+
+// No prefix, every comparison compares the values
+struct NoKeyPrefix {
+    static constexpr bool enabled = false;
+};
+
+// Prefix taken by FrankensteinKeyPrefix<T> when a node is created, for values that are expensive to compare
+struct CachedKeyPrefix {
+    static constexpr bool enabled = true;
+};
+
+// Policy bundle of FrankensteinList and Node. Derive from it and override
+// members to pick a different layout, e.g.
+//     struct Compact : DefaultListPolicy { using Links = IndexLinks; using Chains = AscendingChains; };
+struct DefaultListPolicy {
+    using Links = PointerLinks;
+    using Chains = FourWayChains;
+    using Hints = NoJumpHints;
+    using Fingerprint = NoFingerprint;
+    using Stats = NoStats;
+    using Timing = NoTiming;
+    using Runs = NoRuns;
+    using Index = NoHashIndex;
+    using KeyPrefix = NoKeyPrefix;
+};
+
+// Index links with everything else left at the defaults
+struct IndexListPolicy : DefaultListPolicy {
+    using Links = IndexLinks;
+};
+
+// Up to Capacity nodes stored inline, see SmallFrankensteinList
+template<std::uint32_t Capacity>
+struct SmallListPolicy : DefaultListPolicy {
+    using Links = InlineLinks<Capacity>;
+};
+
+// Jump hints eight hops ahead, for long lists walked more often than they change
+struct PrefetchListPolicy : DefaultListPolicy {
+    using Hints = JumpHints<8>;
+};
+
+// Fingerprints for lists compared more often than they change
+struct FingerprintListPolicy : DefaultListPolicy {
+    using Fingerprint = ContentFingerprint;
+};
+
+// Counters for finding out where an operation spends its time
+struct StatsListPolicy : DefaultListPolicy {
+    using Stats = CountingStats;
+};
+
+// Latency histograms for lists whose tail latency is watched in production
+struct TimedListPolicy : DefaultListPolicy {
+    using Timing = OperationTiming;
+};
+
+// Equal-key runs for lists with few distinct values among many
+struct RunListPolicy : DefaultListPolicy {
+    using Runs = EqualRuns;
+};
+
+// Hash index for lists queried and pruned by value
+struct HashedListPolicy : DefaultListPolicy {
+    using Index = HashIndex;
+};
+
+// Cached key prefixes for lists of strings kept in sorted order
+struct PrefixListPolicy : DefaultListPolicy {
+    using KeyPrefix = CachedKeyPrefix;
+};
+
+#endif //FRANKENSTEIN_S_LIST_LISTPOLICY_H
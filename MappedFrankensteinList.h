@@ -0,0 +1,102 @@
+#ifndef FRANKENSTEIN_S_LIST_MAPPEDFRANKENSTEINLIST_H
+#define FRANKENSTEIN_S_LIST_MAPPEDFRANKENSTEINLIST_H
+#include <string>
+#include <type_traits>
+#include "FrankensteinList.h"
+#include "MappedNodeStorage.h"
+
+// Byte offsets from the start of a memory mapping, valid wherever the mapping lands
+struct OffsetLinks {
+    template<typename N> using link_type = std::uint64_t;
+    template<typename N> static constexpr link_type<N> null_link = 0;
+    template<typename N> using Storage = MappedNodeStorage<N>;
+};
+
+// Offset links with the given chain set
+template<typename ChainSet = FourWayChains>
+struct MappedListPolicy : DefaultListPolicy {
+    using Links = OffsetLinks;
+    using Chains = ChainSet;
+};
+
+// FrankensteinList whose nodes live in a memory-mapped file. Opening maps the file
+// and checks its header, nothing is decoded; the list heads are kept in the header.
+// Nodes are written to the file as the list changes, the heads and the slot counter
+// on sync() and when the list is destroyed. A node freed after a sync keeps its slot
+// until the next one, so after a crash no slot the synced heads reach was handed out
+// again; links rewritten in place since the sync are not rolled back, though.
+template<typename T, typename ChainSet = FourWayChains>
+class MappedFrankensteinList : public FrankensteinList<T, MappedListPolicy<ChainSet>> {
+    static_assert(std::is_trivially_copyable<T>::value, "Mapped lists store their values as raw bytes");
+public:
+    using List = FrankensteinList<T, MappedListPolicy<ChainSet>>;
+    using Storage = typename List::Storage;
+
+    explicit MappedFrankensteinList(const std::string&, MapMode = MapMode::ReadWrite);// Open or create a list file
+    MappedFrankensteinList(MappedFrankensteinList&&) noexcept = default;// Move constructor
+    MappedFrankensteinList& operator=(MappedFrankensteinList&&) = delete;// Would empty the file of the target
+    ~MappedFrankensteinList();// Write the heads back and unmap the file
+
+    void sync();// Write the heads into the file and flush it
+    void load(std::istream&) = delete;// The file is the snapshot, use a plain list to load one
+    void recover(const std::string&) = delete;// Recover journals into a plain list
+private:
+    void storeRoots() noexcept;// Copy the list heads into the file header along with the slot counter
+};
+
+// Open or create a list file, the heads come straight from its header
+template<typename T, typename ChainSet>
+MappedFrankensteinList<T, ChainSet>::MappedFrankensteinList(const std::string &path, MapMode mode) {
+    Storage file(path, mode);
+    const auto* h = file.header();
+    for(int i = 0; i < 4; ++i) {
+        if(!file.holds(h->roots[i])) {
+            throw std::runtime_error("Corrupt list heads in mapped list: " + path);
+        }
+    }
+    if(h->roots[4] > file.footprint(0).handedOut) {
+        throw std::runtime_error("Corrupt list size in mapped list: " + path);
+    }
+
+    this->nodes = std::move(file);
+    this->head = h->roots[0];
+    this->tail = h->roots[1];
+    this->asc_head = h->roots[2];
+    this->desc_head = h->roots[3];
+    this->size = h->roots[4];
+}
+
+// Write the heads back and unmap the file. The storage is detached first, so that
+// tearing down the list does not release the nodes in the file.
+template<typename T, typename ChainSet>
+MappedFrankensteinList<T, ChainSet>::~MappedFrankensteinList() {
+    storeRoots();
+    Storage file(std::move(this->nodes));
+    this->head = Storage::null;
+    this->tail = Storage::null;
+    this->asc_head = Storage::null;
+    this->desc_head = Storage::null;
+    this->size = 0;
+}
+
+// Write the heads into the file and flush it
+template<typename T, typename ChainSet>
+void MappedFrankensteinList<T, ChainSet>::sync() {
+    storeRoots();
+    this->nodes.sync();
+}
+
+// Copy the list heads into the file header, committing the slot counter and the freed slots with them
+template<typename T, typename ChainSet>
+void MappedFrankensteinList<T, ChainSet>::storeRoots() noexcept {
+    if(!this->nodes.writable()) return;
+    auto* h = this->nodes.header();
+    h->roots[0] = this->head;
+    h->roots[1] = this->tail;
+    h->roots[2] = this->asc_head;
+    h->roots[3] = this->desc_head;
+    h->roots[4] = this->size;
+    this->nodes.commit();
+}
+
+#endif //FRANKENSTEIN_S_LIST_MAPPEDFRANKENSTEINLIST_H
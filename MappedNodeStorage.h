@@ -0,0 +1,413 @@
+#ifndef FRANKENSTEIN_S_LIST_MAPPEDNODESTORAGE_H
+#define FRANKENSTEIN_S_LIST_MAPPEDNODESTORAGE_H
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "FrankensteinMemory.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// How a mapped list opens its file
+enum class MapMode {
+    ReadOnly,// Map an existing file copy-on-write: changes stay in memory, the file is never written
+    ReadWrite// Map a file shared, creating it when missing; the file grows with the nodes
+};
+
+// Node storage inside a memory mapping. A link is the byte offset of a node from
+// the start of the mapping (0, the header, is null), so links stay valid wherever
+// the file is mapped and a mapped list needs no decoding when it is opened.
+// A default-constructed storage maps anonymous memory instead of a file.
+// In a writable file the header holds the slot counter and free list as of the last
+// commit(), and a freed slot is left untouched until then, so the heads written with
+// the last commit never reach a slot that was handed out again.
+template<typename N>
+class MappedNodeStorage {
+    static_assert(std::is_trivially_copyable<N>::value, "Mapped nodes are stored as raw bytes");
+public:
+    using link_type = std::uint64_t;
+    static constexpr link_type null = 0;
+    static constexpr bool scannable = false;
+
+    // File layout: this header, then the node slots from firstSlot on
+    struct Header {
+        char magic[8];// "FRKLMAP"
+        std::uint32_t version;// Layout version
+        std::uint32_t byteOrder;// 0x01020304 as written by the creating machine
+        std::uint32_t nodeBytes;// sizeof(N)
+        std::uint32_t nodeAlign;// alignof(N)
+        std::uint64_t capacity;// Size of the file and the mapping in bytes
+        std::uint64_t used;// End of the slots handed out as of the last commit, recycled ones included
+        std::uint64_t freeHead;// First recycled slot; a recycled slot stores the next one in place of its node
+        std::uint64_t roots[5];// head, tail, asc_head, desc_head and size of the list, written by its owner
+    };
+
+    MappedNodeStorage() noexcept;// Default constructor, anonymous memory mapped on first use
+    MappedNodeStorage(const std::string&, MapMode);// Map a list file
+    MappedNodeStorage(const MappedNodeStorage&) = delete;
+    MappedNodeStorage(MappedNodeStorage&&) noexcept;// Move constructor
+    ~MappedNodeStorage();// Destructor, unmaps and closes the file
+    MappedNodeStorage& operator=(const MappedNodeStorage&) = delete;
+    MappedNodeStorage& operator=(MappedNodeStorage&&) noexcept;// Move assignment operator
+
+    template<typename... Args>
+    link_type create(Args&&...);// Construct a node in a free slot, growing the mapping when full
+    void destroy(link_type) noexcept;// Recycle the slot of a node
+    N* get(link_type link) const noexcept {// Resolve a link to the node it names
+        return (link == null) ? nullptr : reinterpret_cast<N*>(base + link);
+    }
+    static N* resolve(const MappedNodeStorage *storage, link_type link) noexcept {// Resolve a link through a storage object
+        return storage->get(link);
+    }
+    static void prefetch(const MappedNodeStorage*, link_type) noexcept;// Start loading a slot, ignoring links outside the mapping
+    link_type ref(const N*) const noexcept;// Get the link naming a node
+    bool holds(link_type) const noexcept;// Whether a link is null or the start of a slot handed out so far
+    void swap(MappedNodeStorage&) noexcept;// Exchange storages
+    bool dropAll() noexcept;// Forget every node by resetting the slot counter, not for a writable file
+    StorageFootprint footprint(std::size_t) const noexcept;// Memory held for the given number of live nodes, the mapping counted as heap
+
+    MappedNodeStorage compactTarget(std::size_t);// Anonymous storage for compaction, with room for the nodes reserved here
+    void adopt(MappedNodeStorage&&) noexcept;// Copy the slots of a compaction target over ours, after the old nodes are destroyed
+
+    Header* header() const noexcept {// Get the header of the mapping, null before anything is mapped
+        return reinterpret_cast<Header*>(base);
+    }
+    bool writable() const noexcept {// Whether changes reach the file
+        return fd >= 0 && mode == MapMode::ReadWrite;
+    }
+    void commit() noexcept;// Record the slot counter in the header and make the slots freed since the last commit reusable
+    void sync();// Flush the dirty pages of a writable file
+private:
+    static constexpr std::uint32_t version = 1;
+    static constexpr std::uint64_t firstSlot = (sizeof(Header) + alignof(N) + 63) / 64 * 64;// Slot offsets stay aligned
+    static constexpr std::uint64_t initialCapacity = 1 << 16;
+
+    void reserve(std::uint64_t);// Make room for the given number of bytes, remapping when needed
+    void unmap() noexcept;// Release the mapping and the file
+
+    unsigned char* base;// Start of the mapping
+    std::uint64_t length;// Bytes mapped, the header keeps a copy for the file
+    int fd;// Mapped file, -1 for anonymous memory
+    MapMode mode;// How the file was opened
+    std::uint64_t used;// End of the slots handed out so far, recycled ones included
+    link_type freeHead;// First reusable slot, the header's free list in a writable file
+    std::vector<link_type> released;// Slots of a writable file freed since the last commit
+};
+
+// Default constructor
+template<typename N>
+MappedNodeStorage<N>::MappedNodeStorage() noexcept
+        :base(nullptr), length(0), fd(-1), mode(MapMode::ReadWrite), used(firstSlot), freeHead(null)
+{
+}
+
+// Map a list file; an empty file opened for writing gets a fresh header
+template<typename N>
+MappedNodeStorage<N>::MappedNodeStorage(const std::string &path, MapMode m)
+        :base(nullptr), length(0), fd(-1), mode(m), used(firstSlot), freeHead(null)
+{
+    fd = ::open(path.c_str(), (mode == MapMode::ReadOnly) ? O_RDONLY : (O_RDWR | O_CREAT), 0644);
+    if(fd < 0) {
+        throw std::system_error(errno, std::generic_category(), "Cannot open mapped list " + path);
+    }
+    try {
+        struct stat st;
+        if(::fstat(fd, &st) != 0) {
+            throw std::system_error(errno, std::generic_category(), "Cannot stat mapped list " + path);
+        }
+        std::uint64_t bytes = static_cast<std::uint64_t>(st.st_size);
+        if(bytes == 0 && mode == MapMode::ReadWrite) {
+            reserve(initialCapacity);
+            Header* h = header();
+            std::memcpy(h->magic, "FRKLMAP", 8);
+            h->version = version;
+            h->byteOrder = 0x01020304;
+            h->nodeBytes = sizeof(N);
+            h->nodeAlign = alignof(N);
+            h->used = firstSlot;
+            h->freeHead = null;
+            return;
+        }
+
+        if(bytes < firstSlot) {
+            throw std::runtime_error("Not a mapped list: " + path);
+        }
+        int protection = PROT_READ | PROT_WRITE;
+        int flags = (mode == MapMode::ReadOnly) ? MAP_PRIVATE : MAP_SHARED;
+        void* mapped = ::mmap(nullptr, bytes, protection, flags, fd, 0);
+        if(mapped == MAP_FAILED) {
+            throw std::system_error(errno, std::generic_category(), "Cannot map list " + path);
+        }
+        base = static_cast<unsigned char*>(mapped);
+        length = bytes;
+
+        // The header check is all the opening there is
+        const Header* h = header();
+        if(std::memcmp(h->magic, "FRKLMAP", 8) != 0 || h->version != version || h->byteOrder != 0x01020304) {
+            throw std::runtime_error("Not a mapped list or unsupported version: " + path);
+        }
+        if(h->nodeBytes != sizeof(N) || h->nodeAlign != alignof(N)) {
+            throw std::runtime_error("Mapped list does not match the node type: " + path);
+        }
+        if(h->capacity != bytes || h->used < firstSlot || h->used > bytes || (h->used - firstSlot) % sizeof(N) != 0) {
+            throw std::runtime_error("Corrupt mapped list header: " + path);
+        }
+        used = h->used;
+        if(!holds(h->freeHead)) {
+            throw std::runtime_error("Corrupt mapped list header: " + path);
+        }
+        freeHead = h->freeHead;
+    } catch(...) {
+        unmap();
+        throw;
+    }
+}
+
+// Move constructor
+template<typename N>
+MappedNodeStorage<N>::MappedNodeStorage(MappedNodeStorage &&oth) noexcept
+        :base(oth.base), length(oth.length), fd(oth.fd), mode(oth.mode), used(oth.used), freeHead(oth.freeHead),
+         released(std::move(oth.released))
+{
+    oth.base = nullptr;
+    oth.length = 0;
+    oth.fd = -1;
+    oth.used = firstSlot;
+    oth.freeHead = null;
+    oth.released.clear();
+}
+
+// Destructor
+template<typename N>
+MappedNodeStorage<N>::~MappedNodeStorage() {
+    unmap();
+}
+
+// Move assignment operator
+template<typename N>
+MappedNodeStorage<N>& MappedNodeStorage<N>::operator=(MappedNodeStorage &&oth) noexcept {
+    if(this != &oth) {
+        MappedNodeStorage tmp(std::move(oth));
+        swap(tmp);
+    }
+    return *this;
+}
+
+// Construct a node in a free slot, growing the mapping when full
+template<typename N>
+template<typename... Args>
+typename MappedNodeStorage<N>::link_type MappedNodeStorage<N>::create(Args&&... args) {
+    if(!base) {
+        reserve(initialCapacity);
+    }
+
+    link_type slot = freeHead;
+    if(slot != null) {
+        // The header lets go of the slot first: a crash leaks it rather than hand it out twice
+        std::memcpy(&freeHead, base + slot, sizeof(freeHead));
+        if(writable()) header()->freeHead = freeHead;
+        try {
+            new (base + slot) N(std::forward<Args>(args)...);
+        } catch(...) {
+            std::memcpy(base + slot, &freeHead, sizeof(freeHead));
+            freeHead = slot;
+            if(writable()) header()->freeHead = slot;
+            throw;
+        }
+        return slot;
+    }
+
+    slot = used;
+    if(used + sizeof(N) > length) {
+        // Growing replaces the mapping, and the arguments may refer into the old one
+        N node(std::forward<Args>(args)...);
+        reserve(length * 2);
+        new (base + slot) N(node);
+    } else {
+        new (base + slot) N(std::forward<Args>(args)...);
+    }
+    used += sizeof(N);
+    return slot;
+}
+
+// Recycle the slot of a node, the nodes are trivially destructible. A writable file keeps
+// the node intact until the next commit, since the heads in its header may still reach it.
+template<typename N>
+void MappedNodeStorage<N>::destroy(link_type link) noexcept {
+    if(writable()) {
+        try {
+            released.push_back(link);
+        } catch(const std::bad_alloc&) {
+            // Without memory to remember it the slot is leaked, which the file survives
+        }
+        return;
+    }
+    std::memcpy(base + link, &freeHead, sizeof(freeHead));
+    freeHead = link;
+}
+
+// Start loading a slot, a stale link may point past the slots in use
+template<typename N>
+void MappedNodeStorage<N>::prefetch(const MappedNodeStorage *storage, link_type link) noexcept {
+    if(link == null || !storage->base || link >= storage->used) return;
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(storage->base + link);
+#endif
+}
+
+// Get the link naming a node
+template<typename N>
+typename MappedNodeStorage<N>::link_type MappedNodeStorage<N>::ref(const N *node) const noexcept {
+    if(!node) return null;
+    return static_cast<link_type>(reinterpret_cast<const unsigned char*>(node) - base);
+}
+
+// Whether a link is null or the start of a slot handed out so far
+template<typename N>
+bool MappedNodeStorage<N>::holds(link_type link) const noexcept {
+    return link == null || (link >= firstSlot && link < used && (link - firstSlot) % sizeof(N) == 0);
+}
+
+// Exchange storages
+template<typename N>
+void MappedNodeStorage<N>::swap(MappedNodeStorage &oth) noexcept {
+    std::swap(base, oth.base);
+    std::swap(length, oth.length);
+    std::swap(fd, oth.fd);
+    std::swap(mode, oth.mode);
+    std::swap(used, oth.used);
+    std::swap(freeHead, oth.freeHead);
+    released.swap(oth.released);
+}
+
+// Forget every node by resetting the slot counter. A writable file frees its nodes one by
+// one instead, so that the slots are held back until the next commit like any other.
+template<typename N>
+bool MappedNodeStorage<N>::dropAll() noexcept {
+    if(writable()) return false;
+    used = firstSlot;
+    freeHead = null;
+    return true;
+}
+
+// Anonymous storage for compaction. Our own mapping is grown first, so that
+// adopting the compacted slots afterwards cannot fail.
+template<typename N>
+MappedNodeStorage<N> MappedNodeStorage<N>::compactTarget(std::size_t count) {
+    reserve(firstSlot + count * sizeof(N));
+    MappedNodeStorage target;
+    target.reserve(firstSlot + count * sizeof(N));
+    return target;
+}
+
+// Copy the slots of a compaction target over ours. Both lay their slots out from
+// firstSlot, so the links of the copied nodes stay valid here. Every old slot is
+// overwritten, so none is held back any more.
+template<typename N>
+void MappedNodeStorage<N>::adopt(MappedNodeStorage &&target) noexcept {
+    std::memcpy(base + firstSlot, target.base + firstSlot, target.used - firstSlot);
+    used = target.used;
+    freeHead = target.freeHead;
+    released.clear();
+}
+
+// Record the slot counter in the header and chain the slots freed since the last commit
+// into the free list. The caller writes heads that no longer reach those slots along with it.
+template<typename N>
+void MappedNodeStorage<N>::commit() noexcept {
+    if(!writable()) return;
+    for(link_type slot : released) {
+        std::memcpy(base + slot, &freeHead, sizeof(freeHead));
+        freeHead = slot;
+    }
+    released.clear();
+    header()->used = used;
+    header()->freeHead = freeHead;
+}
+
+// Flush the dirty pages of a writable file
+template<typename N>
+void MappedNodeStorage<N>::sync() {
+    if(writable() && base && ::msync(base, length, MS_SYNC) != 0) {
+        throw std::system_error(errno, std::generic_category(), "Cannot flush mapped list");
+    }
+}
+
+// Make room for the given number of bytes. A file is extended and mapped again;
+// anonymous memory is copied into a larger mapping.
+template<typename N>
+void MappedNodeStorage<N>::reserve(std::uint64_t bytes) {
+    std::uint64_t capacity = length;
+    if(bytes <= capacity) return;
+    if(fd >= 0 && mode == MapMode::ReadOnly) {
+        throw std::runtime_error("Mapped list is opened read-only and has no free slots.");
+    }
+    std::uint64_t grown = capacity ? capacity : initialCapacity;
+    while(grown < bytes) {
+        grown *= 2;
+    }
+
+    void* mapped;
+    if(fd >= 0) {
+        if(::ftruncate(fd, static_cast<off_t>(grown)) != 0) {
+            throw std::system_error(errno, std::generic_category(), "Cannot grow mapped list");
+        }
+        mapped = ::mmap(nullptr, grown, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if(mapped == MAP_FAILED) {
+            throw std::system_error(errno, std::generic_category(), "Cannot map list");
+        }
+        if(base) {
+            ::munmap(base, capacity);
+        }
+    } else {
+        mapped = ::mmap(nullptr, grown, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if(mapped == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        if(base) {
+            std::memcpy(mapped, base, used);
+            ::munmap(base, capacity);
+        }
+    }
+    base = static_cast<unsigned char*>(mapped);
+    length = grown;
+    header()->capacity = grown;
+}
+
+// Release the mapping and the file
+template<typename N>
+void MappedNodeStorage<N>::unmap() noexcept {
+    if(base) {
+        ::munmap(base, length);
+        base = nullptr;
+        length = 0;
+    }
+    if(fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+// Memory held for the given number of live nodes: the slots of the mapping, its header as a table
+// and the tail too short for a slot as allocator overhead
+template<typename N>
+StorageFootprint MappedNodeStorage<N>::footprint(std::size_t) const noexcept {
+    StorageFootprint f;
+    if(!base) return f;
+    f.slots = static_cast<std::size_t>((length - firstSlot) / sizeof(N));
+    f.handedOut = static_cast<std::size_t>((used - firstSlot) / sizeof(N));
+    f.heapBytes = f.slots * sizeof(N);
+    f.allocatorBytes = static_cast<std::size_t>(length - firstSlot) - f.heapBytes;
+    f.tableBytes = static_cast<std::size_t>(firstSlot);
+    return f;
+}
+
+#endif //FRANKENSTEIN_S_LIST_MAPPEDNODESTORAGE_H
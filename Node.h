@@ -1,16 +1,118 @@
 #ifndef FRANKENSTEIN_S_LIST_NODE_H
 #define FRANKENSTEIN_S_LIST_NODE_H
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include "FrankensteinKeyPrefix.h"
+#include "ListPolicy.h"
 
-template<typename T>
-struct Node {
-   explicit Node(T v, Node<T>* n = nullptr, Node<T>* p = nullptr, Node<T>* g = nullptr, Node<T>* l = nullptr)
-        :val(v), next(n), prev(p), greater(g), lesser(l) {}
+// Optional link fields, an empty base when the chain set drops the link
+template<typename Link, bool>
+struct NodePrevLink {
+   explicit NodePrevLink(Link p) :prev(p) {}
+   Link prev;
+};
+template<typename Link>
+struct NodePrevLink<Link, false> {
+   explicit NodePrevLink(Link) {}
+};
+
+template<typename Link, bool>
+struct NodeLesserLink {
+   explicit NodeLesserLink(Link l) :lesser(l) {}
+   Link lesser;
+};
+template<typename Link>
+struct NodeLesserLink<Link, false> {
+   explicit NodeLesserLink(Link) {}
+};
+
+// Jump hint fields, written by walks over const lists as well
+template<typename Link, bool>
+struct NodeJumpHints {
+   NodeJumpHints(Link null) :next_hint(null), greater_hint(null) {}
+   mutable Link next_hint;// Node some hops ahead in the insertion chain
+   mutable Link greater_hint;// Node some hops ahead in the ascending chain
+};
+template<typename Link>
+struct NodeJumpHints<Link, false> {
+   NodeJumpHints(Link) {}
+};
+
+// Links among the nodes of equal value, kept by lists with a hash index
+template<typename Link, bool>
+struct NodeEqualLinks {
+   explicit NodeEqualLinks(Link null) :equal_prev(null), equal_next(null) {}
+   Link equal_prev;// Previous node of the same value in insertion order
+   Link equal_next;// Next node of the same value in insertion order
+};
+template<typename Link>
+struct NodeEqualLinks<Link, false> {
+   explicit NodeEqualLinks(Link) {}
+};
+
+// Run field of lists keeping equal-key runs
+template<bool>
+struct NodeRunIndex {
+   std::uint32_t run = UINT32_MAX;// Entry of the node's run in the list's run table
+};
+template<>
+struct NodeRunIndex<false> {
+};
+
+// Cached key prefix of lists with CachedKeyPrefix, set from the value when the node is created
+template<bool>
+struct NodeKeyPrefix {
+   std::uint64_t prefix = 0;// FrankensteinKeyPrefix of the value
+};
+template<>
+struct NodeKeyPrefix<false> {
+};
+
+template<typename T, typename Policy = DefaultListPolicy>
+struct Node
+        : NodePrevLink<typename Policy::Links::template link_type<Node<T, Policy>>, Policy::Chains::has_prev>,
+          NodeLesserLink<typename Policy::Links::template link_type<Node<T, Policy>>, Policy::Chains::has_lesser>,
+          NodeKeyPrefix<Policy::KeyPrefix::enabled>,
+          NodeJumpHints<typename Policy::Links::template link_type<Node<T, Policy>>, (Policy::Hints::distance > 0)>,
+          NodeEqualLinks<typename Policy::Links::template link_type<Node<T, Policy>>, Policy::Index::enabled>,
+          NodeRunIndex<Policy::Runs::enabled> {
+   using Links = typename Policy::Links;
+   using Chains = typename Policy::Chains;
+   using link_type = typename Links::template link_type<Node>;// Node* for PointerLinks, a slot index for IndexLinks
+   static constexpr link_type null = Links::template null_link<Node>;
+
+   explicit Node(T v, link_type n = null, link_type p = null, link_type g = null, link_type l = null)
+        :NodePrevLink<link_type, Chains::has_prev>(p), NodeLesserLink<link_type, Chains::has_lesser>(l),
+         NodeJumpHints<link_type, (Policy::Hints::distance > 0)>(null), NodeEqualLinks<link_type, Policy::Index::enabled>(null),
+         val(std::move(v)), next(n), greater(g) {
+      if constexpr (Policy::KeyPrefix::enabled) {
+         this->prefix = FrankensteinKeyPrefix<T>::of(val);
+      }
+   }
+
+   T val;
+   link_type next;
+   link_type greater;
+};
+
+// Node of FrankensteinMultiList: the insertion chain plus one greater/lesser pair per sorted index
+template<typename T, std::size_t Indexes>
+struct MultiNode {
+   struct SortedLinks {
+      MultiNode* greater;// Next node in the index's ascending order
+      MultiNode* lesser;// Previous node in the index's ascending order
+   };
+
+   template<typename... Args>
+   explicit MultiNode(std::in_place_t, Args&&... args)
+        :val(std::forward<Args>(args)...), next(nullptr), prev(nullptr), sorted{} {}
 
    T val;
-   Node<T>* next;
-   Node<T>* prev;
-   Node<T>* greater;
-   Node<T>* lesser;
+   MultiNode* next;
+   MultiNode* prev;
+   std::array<SortedLinks, Indexes> sorted;
 };
 
 #endif //FRANKENSTEIN_S_LIST_NODE_H
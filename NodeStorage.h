@@ -0,0 +1,798 @@
+#ifndef FRANKENSTEIN_S_LIST_NODESTORAGE_H
+#define FRANKENSTEIN_S_LIST_NODESTORAGE_H
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "FrankensteinMemory.h"
+
+// Node storage for pointer links: every node is its own allocation from the
+// storage's memory resource and a link is the node's address. Compaction places
+// nodes into slabs, one contiguous allocation each, which are freed once their
+// last node dies.
+template<typename N>
+class PointerNodeStorage {
+public:
+    using link_type = N*;
+    static constexpr bool scannable = false;
+
+    PointerNodeStorage() noexcept;// Default constructor, allocates from the default memory resource
+    explicit PointerNodeStorage(std::pmr::memory_resource*) noexcept;// Allocate from the given memory resource
+    PointerNodeStorage(const PointerNodeStorage&) = delete;
+    PointerNodeStorage(PointerNodeStorage&&) noexcept;// Move constructor
+    ~PointerNodeStorage();// Destructor, frees the slabs; live nodes must already be destroyed
+    PointerNodeStorage& operator=(const PointerNodeStorage&) = delete;
+    PointerNodeStorage& operator=(PointerNodeStorage&&) noexcept;// Move assignment operator
+
+    template<typename... Args>
+    link_type create(Args&&...);// Allocate and construct a node, in the open slab while one has room
+    void destroy(link_type) noexcept;// Destroy and free a node
+    N* get(link_type link) const noexcept {// Resolve a link to the node it names
+        return link;
+    }
+    static N* resolve(const PointerNodeStorage*, link_type link) noexcept {// Resolve a link without a storage object
+        return link;
+    }
+    static void prefetch(const PointerNodeStorage*, link_type link) noexcept {// Start loading a node that may be gone already
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(link);
+#else
+        (void)link;
+#endif
+    }
+    link_type ref(const N* node) const noexcept {// Get the link naming a node
+        return const_cast<N*>(node);
+    }
+    void swap(PointerNodeStorage&) noexcept;// Exchange storages
+    std::pmr::memory_resource* resource() const noexcept {// Get the memory resource the nodes come from
+        return memory;
+    }
+    bool dropAll() noexcept;// Forget every node without destroying it, if the resource frees nothing anyway
+    StorageFootprint footprint(std::size_t) const noexcept;// Memory held for the given number of live nodes
+
+    PointerNodeStorage compactTarget(std::size_t);// Storage whose next creates land in one contiguous slab
+    void adopt(PointerNodeStorage&&) noexcept;// Take over the slabs of a compaction target, after the old nodes are destroyed
+    void openSlab(std::size_t);// Start a slab that following creates fill in order
+    bool slabFull() const noexcept;// Check whether the open slab has no room left
+    void closeSlab() noexcept;// Stop filling the open slab
+    void pauseSlab() noexcept;// Send creates to the resource again, keeping the open slab for resumeSlab()
+    void resumeSlab() noexcept;// Let creates fill the open slab again
+private:
+    struct Slab {
+        N* begin;// First slot of the slab
+        std::size_t capacity;// Number of slots
+        std::size_t filled;// Slots handed out so far
+        std::size_t live;// Slots holding a node
+    };
+    void freeSlab(std::size_t) noexcept;// Release a slab, its nodes must already be destroyed
+
+    std::pmr::memory_resource* memory;// Source of the nodes and slabs
+    bool monotonic;// Whether deallocating from the resource is a no-op
+    std::vector<Slab> slabs;// Slabs created by compaction
+    bool open;// Whether the last slab is still being filled
+    bool paused;// Whether creates bypass the open slab for now
+};
+
+// Node storage for 32-bit index links: nodes live in an arena owned by the list
+// and a link is the node's slot number. Block b holds (16 << b) slots, so an index
+// resolves to its block with a single bit scan and blocks never move once allocated.
+// The blocks come from the storage's memory resource.
+template<typename N>
+class ArenaNodeStorage {
+public:
+    using link_type = std::uint32_t;
+    static constexpr link_type null = UINT32_MAX;
+    static constexpr bool scannable = false;
+
+    ArenaNodeStorage() noexcept;// Default constructor, allocates from the default memory resource
+    explicit ArenaNodeStorage(std::pmr::memory_resource*) noexcept;// Allocate from the given memory resource
+    ArenaNodeStorage(const ArenaNodeStorage&) = delete;
+    ArenaNodeStorage(ArenaNodeStorage&&) noexcept;// Move constructor
+    ~ArenaNodeStorage();// Destructor, frees the blocks; live nodes must already be destroyed
+    ArenaNodeStorage& operator=(const ArenaNodeStorage&) = delete;
+    ArenaNodeStorage& operator=(ArenaNodeStorage&&) noexcept;// Move assignment operator
+
+    template<typename... Args>
+    link_type create(Args&&...);// Allocate a slot and construct a node in it
+    void destroy(link_type) noexcept;// Destroy a node and recycle its slot
+    N* get(link_type) const noexcept;// Resolve a link to the node it names
+    static N* resolve(const ArenaNodeStorage*, link_type) noexcept;// Resolve a link through a storage object
+    static void prefetch(const ArenaNodeStorage*, link_type) noexcept;// Start loading a slot, ignoring links outside the arena
+    link_type ref(const N*) const noexcept;// Get the link naming a node, by searching the blocks
+    void swap(ArenaNodeStorage&) noexcept;// Exchange storages
+    std::pmr::memory_resource* resource() const noexcept {// Get the memory resource the blocks come from
+        return memory;
+    }
+    bool dropAll() noexcept;// Forget every node without destroying it by releasing the blocks
+    StorageFootprint footprint(std::size_t) const noexcept;// Memory held for the given number of live nodes
+
+    ArenaNodeStorage compactTarget(std::size_t);// Storage whose first slots are one contiguous allocation
+    void adopt(ArenaNodeStorage&&) noexcept;// Replace this arena by a compaction target, after the old nodes are destroyed
+private:
+    static constexpr unsigned firstBlockBits = 4;// The first block holds 16 slots
+
+    static unsigned floorLog2(std::uint32_t) noexcept;// Index of the highest set bit
+    static std::size_t blockSize(std::size_t b) noexcept { return std::size_t(1) << (firstBlockBits + b); }
+    static std::size_t blockStart(std::size_t b) noexcept { return ((std::size_t(1) << b) - 1) << firstBlockBits; }
+    void release() noexcept;// Free every block
+    N* allocate(std::size_t);// Allocate a run of slots from the resource
+    void deallocate(N*, std::size_t) noexcept;// Return a run of slots to the resource
+
+    std::pmr::memory_resource* memory;// Source of the blocks
+    std::vector<N*> blocks;// Slot blocks, block b holds blockSize(b) slots
+    std::size_t bulkBlocks;// Leading blocks carved from one allocation by compactTarget()
+    std::uint32_t used;// Slots handed out so far, recycled ones included
+    link_type freeHead;// First recycled slot; a recycled slot stores the next one in place of its node
+};
+
+// Node storage for small lists: the first Capacity nodes live inside the storage
+// object itself and links are slot numbers, so moving the storage relocates the
+// inline nodes without touching any link. Slots past Capacity spill into an
+// ArenaNodeStorage. Needs a node type that moves without throwing.
+template<typename N, std::uint32_t Capacity>
+class InlineNodeStorage {
+    static_assert(Capacity > 0, "An inline storage needs at least one slot");
+    static_assert(std::is_nothrow_move_constructible<N>::value, "Inline nodes are relocated when the storage moves");
+public:
+    using link_type = std::uint32_t;
+    static constexpr link_type null = UINT32_MAX;
+    static constexpr bool scannable = true;
+
+    InlineNodeStorage() noexcept;// Default constructor, spills to the default memory resource
+    explicit InlineNodeStorage(std::pmr::memory_resource*) noexcept;// Spill to the given memory resource
+    InlineNodeStorage(const InlineNodeStorage&) = delete;
+    InlineNodeStorage(InlineNodeStorage&&) noexcept;// Move constructor, relocates the inline nodes
+    ~InlineNodeStorage() = default;// Live nodes must already be destroyed
+    InlineNodeStorage& operator=(const InlineNodeStorage&) = delete;
+    InlineNodeStorage& operator=(InlineNodeStorage&&) noexcept;// Move assignment operator, live nodes must already be destroyed
+
+    template<typename... Args>
+    link_type create(Args&&...);// Construct a node in a free inline slot, or in the spill arena when they are taken
+    void destroy(link_type) noexcept;// Destroy a node and recycle its slot
+    N* get(link_type) const noexcept;// Resolve a link to the node it names
+    static N* resolve(const InlineNodeStorage*, link_type) noexcept;// Resolve a link through a storage object
+    static void prefetch(const InlineNodeStorage*, link_type) noexcept;// Start loading a slot, ignoring links outside the storage
+    link_type ref(const N*) const noexcept;// Get the link naming a node
+    void swap(InlineNodeStorage&) noexcept;// Exchange storages, relocating the inline nodes of both
+    std::pmr::memory_resource* resource() const noexcept {// Get the memory resource the spilled nodes come from
+        return spill.resource();
+    }
+    bool dropAll() noexcept;// Forget every node without destroying it
+    StorageFootprint footprint(std::size_t) const noexcept;// Memory held for the given number of live nodes
+
+    template<typename Visit>
+    bool scan(Visit&&) const;// Visit every node in slot order if none spilled, false otherwise
+
+    InlineNodeStorage compactTarget(std::size_t);// Empty storage for compaction, filled inline first
+    void adopt(InlineNodeStorage&&) noexcept;// Take over a compaction target, after the old nodes are destroyed
+private:
+    using Arena = ArenaNodeStorage<N>;
+
+    N* slot(std::uint32_t i) const noexcept {// Inline slot i
+        return std::launder(reinterpret_cast<N*>(const_cast<unsigned char*>(buffer) + i * sizeof(N)));
+    }
+    void take(InlineNodeStorage&) noexcept;// Move the contents of another storage into this empty one
+
+    alignas(N) unsigned char buffer[Capacity * sizeof(N)];// Inline slots
+    std::uint64_t live[(Capacity + 63) / 64];// Inline slots holding a node, one bit each
+    std::uint32_t used;// Inline slots handed out so far, recycled ones included
+    link_type freeHead;// First recycled inline slot; a recycled slot stores the next one in place of its node
+    std::uint32_t spilled;// Nodes living in the spill arena
+    Arena spill;// Nodes beyond the inline slots, linked as Capacity + their arena slot
+};
+
+// Whether deallocating from a resource is a no-op, so its memory goes only with the resource
+inline bool isMonotonicResource(const std::pmr::memory_resource *resource) noexcept {
+    return dynamic_cast<const std::pmr::monotonic_buffer_resource*>(resource) != nullptr;
+}
+
+// Default constructor
+template<typename N>
+PointerNodeStorage<N>::PointerNodeStorage() noexcept
+        :PointerNodeStorage(std::pmr::get_default_resource())
+{
+}
+
+// Constructor with a memory resource
+template<typename N>
+PointerNodeStorage<N>::PointerNodeStorage(std::pmr::memory_resource *resource) noexcept
+        :memory(resource), monotonic(isMonotonicResource(resource)), open(false), paused(false)
+{
+}
+
+// Move constructor
+template<typename N>
+PointerNodeStorage<N>::PointerNodeStorage(PointerNodeStorage &&oth) noexcept
+        :memory(oth.memory), monotonic(oth.monotonic), slabs(std::move(oth.slabs)), open(oth.open), paused(oth.paused)
+{
+    oth.slabs.clear();
+    oth.open = false;
+    oth.paused = false;
+}
+
+// Destructor
+template<typename N>
+PointerNodeStorage<N>::~PointerNodeStorage() {
+    while(!slabs.empty()) {
+        freeSlab(slabs.size() - 1);
+    }
+}
+
+// Move assignment operator
+template<typename N>
+PointerNodeStorage<N>& PointerNodeStorage<N>::operator=(PointerNodeStorage &&oth) noexcept {
+    if(this != &oth) {
+        PointerNodeStorage tmp(std::move(oth));
+        swap(tmp);
+    }
+    return *this;
+}
+
+// Allocate and construct a node, in the open slab while one has room and is not paused
+template<typename N>
+template<typename... Args>
+typename PointerNodeStorage<N>::link_type PointerNodeStorage<N>::create(Args&&... args) {
+    if(open && !paused && !slabFull()) {
+        Slab& slab = slabs.back();
+        N* node = new (slab.begin + slab.filled) N(std::forward<Args>(args)...);
+        ++slab.filled;
+        ++slab.live;
+        return node;
+    }
+    void* raw = memory->allocate(sizeof(N), alignof(N));
+    try {
+        return new (raw) N(std::forward<Args>(args)...);
+    } catch(...) {
+        memory->deallocate(raw, sizeof(N), alignof(N));
+        throw;
+    }
+}
+
+// Destroy and free a node, releasing its slab with the last node in it
+template<typename N>
+void PointerNodeStorage<N>::destroy(link_type node) noexcept {
+    for(std::size_t i = slabs.size(); i > 0; --i) {
+        Slab& slab = slabs[i - 1];
+        if(node >= slab.begin && node < slab.begin + slab.capacity) {
+            node->~N();
+            if(--slab.live == 0 && !(open && i == slabs.size())) {
+                freeSlab(i - 1);
+            }
+            return;
+        }
+    }
+    node->~N();
+    memory->deallocate(node, sizeof(N), alignof(N));
+}
+
+// Exchange storages
+template<typename N>
+void PointerNodeStorage<N>::swap(PointerNodeStorage &oth) noexcept {
+    std::swap(memory, oth.memory);
+    std::swap(monotonic, oth.monotonic);
+    slabs.swap(oth.slabs);
+    std::swap(open, oth.open);
+    std::swap(paused, oth.paused);
+}
+
+// Storage whose next creates land in one contiguous slab
+template<typename N>
+PointerNodeStorage<N> PointerNodeStorage<N>::compactTarget(std::size_t count) {
+    slabs.reserve(slabs.size() + 1);// adopt() must not fail once the nodes have moved
+    PointerNodeStorage target(memory);
+    target.openSlab(count);
+    return target;
+}
+
+// Take over the slabs of a compaction target
+template<typename N>
+void PointerNodeStorage<N>::adopt(PointerNodeStorage &&target) noexcept {
+    target.closeSlab();
+    if(open) {
+        // Keep the open slab last, it is the one creates go to
+        slabs.insert(slabs.end() - 1, target.slabs.begin(), target.slabs.end());
+    } else {
+        slabs.insert(slabs.end(), target.slabs.begin(), target.slabs.end());
+    }
+    target.slabs.clear();
+}
+
+// Start a slab that following creates fill in order
+template<typename N>
+void PointerNodeStorage<N>::openSlab(std::size_t count) {
+    closeSlab();
+    slabs.reserve(slabs.size() + 1);
+    std::size_t capacity = count ? count : 1;
+    N* begin = static_cast<N*>(memory->allocate(capacity * sizeof(N), alignof(N)));
+    slabs.push_back(Slab{begin, capacity, 0, 0});
+    open = true;
+    paused = false;
+}
+
+// Check whether the open slab has no room left
+template<typename N>
+bool PointerNodeStorage<N>::slabFull() const noexcept {
+    return !open || slabs.back().filled == slabs.back().capacity;
+}
+
+// Stop filling the open slab, it goes once it holds no node
+template<typename N>
+void PointerNodeStorage<N>::closeSlab() noexcept {
+    if(!open) return;
+    open = false;
+    paused = false;
+    if(slabs.back().live == 0) {
+        freeSlab(slabs.size() - 1);
+    }
+}
+
+// Send creates to the resource again, the open slab keeps its place for resumeSlab()
+template<typename N>
+void PointerNodeStorage<N>::pauseSlab() noexcept {
+    paused = true;
+}
+
+// Let creates fill the open slab again
+template<typename N>
+void PointerNodeStorage<N>::resumeSlab() noexcept {
+    paused = false;
+}
+
+// Release a slab, its nodes must already be destroyed
+template<typename N>
+void PointerNodeStorage<N>::freeSlab(std::size_t i) noexcept {
+    memory->deallocate(slabs[i].begin, slabs[i].capacity * sizeof(N), alignof(N));
+    slabs.erase(slabs.begin() + i);
+}
+
+// Forget every node without destroying it. Only a resource that frees nothing
+// on deallocate allows this; its memory goes back when the resource is released.
+template<typename N>
+bool PointerNodeStorage<N>::dropAll() noexcept {
+    if(!monotonic) return false;
+    slabs.clear();
+    open = false;
+    return true;
+}
+
+// Memory held for the given number of live nodes: one allocation per node outside the slabs
+template<typename N>
+StorageFootprint PointerNodeStorage<N>::footprint(std::size_t live) const noexcept {
+    StorageFootprint f;
+    std::size_t inSlabs = 0;
+    for(const Slab &slab : slabs) {
+        f.slots += slab.capacity;
+        f.handedOut += slab.filled;
+        f.heapBytes += slab.capacity * sizeof(N);
+        f.allocatorBytes += frankenstein_memory::allocationOverhead(memory, slab.capacity * sizeof(N));
+        inSlabs += slab.live;
+    }
+    std::size_t single = live - inSlabs;
+    f.slots += single;
+    f.handedOut += single;
+    f.heapBytes += single * sizeof(N);
+    f.allocatorBytes += single * frankenstein_memory::allocationOverhead(memory, sizeof(N));
+    f.tableBytes = slabs.capacity() * sizeof(Slab);
+    return f;
+}
+
+// Default constructor
+template<typename N>
+ArenaNodeStorage<N>::ArenaNodeStorage() noexcept
+        :ArenaNodeStorage(std::pmr::get_default_resource())
+{
+}
+
+// Constructor with a memory resource
+template<typename N>
+ArenaNodeStorage<N>::ArenaNodeStorage(std::pmr::memory_resource *resource) noexcept
+        :memory(resource), bulkBlocks(0), used(0), freeHead(null)
+{
+}
+
+// Move constructor
+template<typename N>
+ArenaNodeStorage<N>::ArenaNodeStorage(ArenaNodeStorage &&oth) noexcept
+        :memory(oth.memory), blocks(std::move(oth.blocks)), bulkBlocks(oth.bulkBlocks), used(oth.used), freeHead(oth.freeHead)
+{
+    oth.blocks.clear();
+    oth.bulkBlocks = 0;
+    oth.used = 0;
+    oth.freeHead = null;
+}
+
+// Destructor
+template<typename N>
+ArenaNodeStorage<N>::~ArenaNodeStorage() {
+    release();
+}
+
+// Move assignment operator
+template<typename N>
+ArenaNodeStorage<N>& ArenaNodeStorage<N>::operator=(ArenaNodeStorage &&oth) noexcept {
+    if(this != &oth) {
+        release();
+        swap(oth);
+    }
+    return *this;
+}
+
+// Allocate a slot, growing the arena by one block when it is full
+template<typename N>
+template<typename... Args>
+typename ArenaNodeStorage<N>::link_type ArenaNodeStorage<N>::create(Args&&... args) {
+    link_type slot;
+    if(freeHead != null) {
+        slot = freeHead;
+        void* raw = get(slot);
+        freeHead = *std::launder(static_cast<link_type*>(raw));
+        try {
+            new (raw) N(std::forward<Args>(args)...);
+        } catch(...) {
+            new (raw) link_type(freeHead);
+            freeHead = slot;
+            throw;
+        }
+        return slot;
+    }
+
+    if(used == null) {
+        throw std::length_error("Index arena is full.");
+    }
+    if(used == blockStart(blocks.size())) {
+        blocks.reserve(blocks.size() + 1);
+        blocks.push_back(allocate(blockSize(blocks.size())));
+    }
+    slot = used;
+    new (get(slot)) N(std::forward<Args>(args)...);
+    ++used;
+    return slot;
+}
+
+// Destroy a node and recycle its slot
+template<typename N>
+void ArenaNodeStorage<N>::destroy(link_type link) noexcept {
+    N* node = get(link);
+    node->~N();
+    new (static_cast<void*>(node)) link_type(freeHead);
+    freeHead = link;
+}
+
+// Resolve a link to the node it names
+template<typename N>
+N* ArenaNodeStorage<N>::get(link_type link) const noexcept {
+    if(link == null) return nullptr;
+    unsigned b = floorLog2((link >> firstBlockBits) + 1);
+    return blocks[b] + (link - blockStart(b));
+}
+
+// Resolve a link through a storage object
+template<typename N>
+N* ArenaNodeStorage<N>::resolve(const ArenaNodeStorage *storage, link_type link) noexcept {
+    return storage->get(link);
+}
+
+// Start loading a slot, a stale link may name a slot the arena no longer has
+template<typename N>
+void ArenaNodeStorage<N>::prefetch(const ArenaNodeStorage *storage, link_type link) noexcept {
+    if(link >= storage->used) return;
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(storage->get(link));
+#endif
+}
+
+// Get the link naming a node, by searching the blocks
+template<typename N>
+typename ArenaNodeStorage<N>::link_type ArenaNodeStorage<N>::ref(const N *node) const noexcept {
+    if(!node) return null;
+    for(std::size_t b = 0; b < blocks.size(); ++b) {
+        if(node >= blocks[b] && node < blocks[b] + blockSize(b)) {
+            return static_cast<link_type>(blockStart(b) + (node - blocks[b]));
+        }
+    }
+    return null;
+}
+
+// Exchange storages
+template<typename N>
+void ArenaNodeStorage<N>::swap(ArenaNodeStorage &oth) noexcept {
+    std::swap(memory, oth.memory);
+    blocks.swap(oth.blocks);
+    std::swap(bulkBlocks, oth.bulkBlocks);
+    std::swap(used, oth.used);
+    std::swap(freeHead, oth.freeHead);
+}
+
+// Storage whose first slots are one contiguous allocation, so nodes created
+// in traversal order sit next to each other
+template<typename N>
+ArenaNodeStorage<N> ArenaNodeStorage<N>::compactTarget(std::size_t count) {
+    ArenaNodeStorage target(memory);
+    std::size_t bulk = 1;
+    while(blockStart(bulk) < count) {
+        ++bulk;
+    }
+    target.blocks.reserve(bulk);
+    N* base = target.allocate(blockStart(bulk));
+    for(std::size_t b = 0; b < bulk; ++b) {
+        target.blocks.push_back(base + blockStart(b));
+    }
+    target.bulkBlocks = bulk;
+    return target;
+}
+
+// Replace this arena by a compaction target, after the old nodes are destroyed
+template<typename N>
+void ArenaNodeStorage<N>::adopt(ArenaNodeStorage &&target) noexcept {
+    release();
+    swap(target);
+}
+
+// Index of the highest set bit
+template<typename N>
+unsigned ArenaNodeStorage<N>::floorLog2(std::uint32_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return 31u - static_cast<unsigned>(__builtin_clz(x));
+#else
+    unsigned r = 0;
+    while(x >>= 1) {
+        ++r;
+    }
+    return r;
+#endif
+}
+
+// Free every block
+template<typename N>
+void ArenaNodeStorage<N>::release() noexcept {
+    if(bulkBlocks) {
+        deallocate(blocks[0], blockStart(bulkBlocks));
+    }
+    for(std::size_t b = bulkBlocks; b < blocks.size(); ++b) {
+        deallocate(blocks[b], blockSize(b));
+    }
+    blocks.clear();
+    bulkBlocks = 0;
+    used = 0;
+    freeHead = null;
+}
+
+// Allocate a run of slots from the resource
+template<typename N>
+N* ArenaNodeStorage<N>::allocate(std::size_t slots) {
+    return static_cast<N*>(memory->allocate(slots * sizeof(N), alignof(N)));
+}
+
+// Return a run of slots to the resource
+template<typename N>
+void ArenaNodeStorage<N>::deallocate(N *slots, std::size_t count) noexcept {
+    memory->deallocate(slots, count * sizeof(N), alignof(N));
+}
+
+// Forget every node without destroying it, the blocks go back to the resource in one sweep
+template<typename N>
+bool ArenaNodeStorage<N>::dropAll() noexcept {
+    release();
+    return true;
+}
+
+// Memory held for the given number of live nodes; slots recycled into the free list count as handed out
+template<typename N>
+StorageFootprint ArenaNodeStorage<N>::footprint(std::size_t) const noexcept {
+    StorageFootprint f;
+    f.slots = blocks.empty() ? 0 : blockStart(blocks.size());
+    f.handedOut = used;
+    f.heapBytes = f.slots * sizeof(N);
+    for(std::size_t b = bulkBlocks; b < blocks.size(); ++b) {
+        f.allocatorBytes += frankenstein_memory::allocationOverhead(memory, blockSize(b) * sizeof(N));
+    }
+    if(bulkBlocks) {
+        f.allocatorBytes += frankenstein_memory::allocationOverhead(memory, blockStart(bulkBlocks) * sizeof(N));
+    }
+    f.tableBytes = blocks.capacity() * sizeof(N*);
+    return f;
+}
+
+// Default constructor
+template<typename N, std::uint32_t Capacity>
+InlineNodeStorage<N, Capacity>::InlineNodeStorage() noexcept
+        :InlineNodeStorage(std::pmr::get_default_resource())
+{
+}
+
+// Constructor with a memory resource for the spilled nodes
+template<typename N, std::uint32_t Capacity>
+InlineNodeStorage<N, Capacity>::InlineNodeStorage(std::pmr::memory_resource *resource) noexcept
+        :live{}, used(0), freeHead(null), spilled(0), spill(resource)
+{
+}
+
+// Move constructor
+template<typename N, std::uint32_t Capacity>
+InlineNodeStorage<N, Capacity>::InlineNodeStorage(InlineNodeStorage &&oth) noexcept
+        :InlineNodeStorage(oth.resource())
+{
+    take(oth);
+}
+
+// Move assignment operator
+template<typename N, std::uint32_t Capacity>
+InlineNodeStorage<N, Capacity>& InlineNodeStorage<N, Capacity>::operator=(InlineNodeStorage &&oth) noexcept {
+    if(this != &oth) {
+        dropAll();
+        take(oth);
+    }
+    return *this;
+}
+
+// Construct a node in a free inline slot, or in the spill arena when they are taken
+template<typename N, std::uint32_t Capacity>
+template<typename... Args>
+typename InlineNodeStorage<N, Capacity>::link_type InlineNodeStorage<N, Capacity>::create(Args&&... args) {
+    std::uint32_t i;
+    if(freeHead != null) {
+        i = freeHead;
+        freeHead = *std::launder(reinterpret_cast<link_type*>(slot(i)));
+    } else if(used < Capacity) {
+        i = used++;
+    } else {
+        link_type link = spill.create(std::forward<Args>(args)...);
+        if(link >= null - Capacity) {
+            spill.destroy(link);
+            throw std::length_error("Inline storage is full.");
+        }
+        ++spilled;
+        return Capacity + link;
+    }
+
+    try {
+        new (slot(i)) N(std::forward<Args>(args)...);
+    } catch(...) {
+        new (slot(i)) link_type(freeHead);
+        freeHead = i;
+        throw;
+    }
+    live[i / 64] |= std::uint64_t(1) << (i % 64);
+    return i;
+}
+
+// Destroy a node and recycle its slot
+template<typename N, std::uint32_t Capacity>
+void InlineNodeStorage<N, Capacity>::destroy(link_type link) noexcept {
+    if(link >= Capacity) {
+        spill.destroy(link - Capacity);
+        --spilled;
+        return;
+    }
+    slot(link)->~N();
+    live[link / 64] &= ~(std::uint64_t(1) << (link % 64));
+    new (slot(link)) link_type(freeHead);
+    freeHead = link;
+}
+
+// Resolve a link to the node it names
+template<typename N, std::uint32_t Capacity>
+N* InlineNodeStorage<N, Capacity>::get(link_type link) const noexcept {
+    if(link < Capacity) return slot(link);
+    if(link == null) return nullptr;
+    return spill.get(link - Capacity);
+}
+
+// Resolve a link through a storage object
+template<typename N, std::uint32_t Capacity>
+N* InlineNodeStorage<N, Capacity>::resolve(const InlineNodeStorage *storage, link_type link) noexcept {
+    return storage->get(link);
+}
+
+// Start loading a slot, a stale link may name a slot the storage no longer has
+template<typename N, std::uint32_t Capacity>
+void InlineNodeStorage<N, Capacity>::prefetch(const InlineNodeStorage *storage, link_type link) noexcept {
+    if(link < Capacity) {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(storage->slot(link));
+#endif
+    } else if(link != null) {
+        Arena::prefetch(&storage->spill, link - Capacity);
+    }
+}
+
+// Get the link naming a node
+template<typename N, std::uint32_t Capacity>
+typename InlineNodeStorage<N, Capacity>::link_type InlineNodeStorage<N, Capacity>::ref(const N *node) const noexcept {
+    if(!node) return null;
+    const unsigned char* raw = reinterpret_cast<const unsigned char*>(node);
+    if(raw >= buffer && raw < buffer + sizeof(buffer)) {
+        return static_cast<link_type>((raw - buffer) / sizeof(N));
+    }
+    link_type link = spill.ref(node);
+    return (link == null) ? null : Capacity + link;
+}
+
+// Exchange storages, relocating the inline nodes of both
+template<typename N, std::uint32_t Capacity>
+void InlineNodeStorage<N, Capacity>::swap(InlineNodeStorage &oth) noexcept {
+    if(this == &oth) return;
+    InlineNodeStorage tmp(std::move(oth));
+    oth.take(*this);
+    take(tmp);
+}
+
+// Forget every node without destroying it
+template<typename N, std::uint32_t Capacity>
+bool InlineNodeStorage<N, Capacity>::dropAll() noexcept {
+    for(std::uint64_t &word : live) {
+        word = 0;
+    }
+    used = 0;
+    freeHead = null;
+    spilled = 0;
+    return spill.dropAll();
+}
+
+// Memory held for the given number of live nodes: the inline slots plus the spill arena
+template<typename N, std::uint32_t Capacity>
+StorageFootprint InlineNodeStorage<N, Capacity>::footprint(std::size_t) const noexcept {
+    StorageFootprint f = spill.footprint(spilled);
+    f.slots += Capacity;
+    f.handedOut += used;
+    f.inlineBytes = sizeof(buffer);
+    return f;
+}
+
+// Visit every node in slot order if none spilled: a flat loop over the inline slots
+template<typename N, std::uint32_t Capacity>
+template<typename Visit>
+bool InlineNodeStorage<N, Capacity>::scan(Visit &&visit) const {
+    if(spilled) return false;
+    for(std::uint32_t i = 0; i < used; ++i) {
+        if(live[i / 64] & (std::uint64_t(1) << (i % 64))) {
+            visit(*slot(i));
+        }
+    }
+    return true;
+}
+
+// Empty storage for compaction, filled inline first
+template<typename N, std::uint32_t Capacity>
+InlineNodeStorage<N, Capacity> InlineNodeStorage<N, Capacity>::compactTarget(std::size_t count) {
+    InlineNodeStorage target(resource());
+    if(count > Capacity) {
+        target.spill = spill.compactTarget(count - Capacity);
+    }
+    return target;
+}
+
+// Take over a compaction target, after the old nodes are destroyed
+template<typename N, std::uint32_t Capacity>
+void InlineNodeStorage<N, Capacity>::adopt(InlineNodeStorage &&target) noexcept {
+    *this = std::move(target);
+}
+
+// Move the contents of another storage into this empty one
+template<typename N, std::uint32_t Capacity>
+void InlineNodeStorage<N, Capacity>::take(InlineNodeStorage &oth) noexcept {
+    for(std::uint32_t i = 0; i < oth.used; ++i) {
+        N* from = oth.slot(i);
+        if(oth.live[i / 64] & (std::uint64_t(1) << (i % 64))) {
+            new (slot(i)) N(std::move(*from));
+            from->~N();
+        } else {
+            new (slot(i)) link_type(*std::launder(reinterpret_cast<link_type*>(from)));
+        }
+    }
+    std::copy(std::begin(oth.live), std::end(oth.live), std::begin(live));
+    used = oth.used;
+    freeHead = oth.freeHead;
+    spilled = oth.spilled;
+    spill.swap(oth.spill);
+
+    oth.dropAll();
+}
+
+#endif //FRANKENSTEIN_S_LIST_NODESTORAGE_H
@@ -0,0 +1,344 @@
+#ifndef FRANKENSTEIN_S_LIST_RECORDINGFRANKENSTEINLIST_H
+#define FRANKENSTEIN_S_LIST_RECORDINGFRANKENSTEINLIST_H
+#include <cstdint>
+#include <fstream>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "FrankensteinList.h"
+#include "FrankensteinTrace.h"
+
+// Wrapper recording the calls made through it to a FrankensteinList as an operation trace.
+// The trace starts with a snapshot of the list, so replaying it on the snapshot repeats the
+// workload exactly. Calls made on the list directly are not recorded; calls that throw are
+// not recorded either, as they changed nothing.
+template<typename T, typename Policy = DefaultListPolicy>
+class RecordingFrankensteinList {
+public:
+    using List = FrankensteinList<T, Policy>;
+    using NodeType = typename List::NodeType;
+    using PrintOrder = typename List::PrintOrder;
+    using Op = frankenstein_trace::Op;
+
+    // A decoded trace record
+    struct Record {
+        Op op;
+        T value{};
+        std::uint64_t position = 0;// Position, new size or scan order
+        std::uint64_t count = 0;// Count of a range erase or assign
+    };
+
+    RecordingFrankensteinList(List&, std::ostream&);// Record to a stream, starting with a snapshot of the list
+    RecordingFrankensteinList(List&, const std::string&);// Record to a file, replacing it
+    RecordingFrankensteinList(const RecordingFrankensteinList&) = delete;
+    RecordingFrankensteinList& operator=(const RecordingFrankensteinList&) = delete;
+
+    void push_back(const T&);// Insert an element at the back
+    void push_front(const T&);// Insert an element at the front
+    void insertAt(const T&, std::size_t);// Insert an element at a specified position
+    void pop_front();// Remove the element from the front
+    void pop_back();// Remove the element from the back
+    void erase(const T&);// Erase the element at a specific position
+    void erase(const T&, std::size_t);// Erase a range of elements starting at a specific position
+    void remove(const T&);// Remove elements with a specific value
+    void unique();// Remove the repeated values
+    void reverse();// Reverse the order of elements in the list
+    void sort();// Sort the list
+    void resize(std::size_t);// Resize the list
+    void assign(std::size_t, const T&);// Assign a specified number of elements with the given value
+    bool contains(const T&) const;// Check whether a value is present
+    std::size_t count(const T&) const;// Count the occurrences of a value
+    NodeType* getNodeAt(std::size_t) const;// Get a pointer to the node at a specified position
+    template<typename Visit>
+    void scan(PrintOrder, Visit&&) const;// Visit every value in a print order, Visit(const T&)
+
+    List& list() const;// The list recorded
+    void flush();// Write the buffered records to the stream
+
+    static std::vector<Record> readTrace(std::istream&, List&);// Load a trace's starting snapshot into a list and decode its records
+    static std::size_t apply(List&, const Record&);// Repeat a recorded call, returning what a query found so it cannot be optimized away
+private:
+    void start();// Write the header and the starting snapshot
+    void record(Op, const T* = nullptr, std::initializer_list<std::uint64_t> = {}) const;// Write a record: the value if any as in snapshots, then the numbers as varints
+
+    List& target;// List the calls go to
+    std::unique_ptr<std::ofstream> file;// Trace file when recording to a path
+    std::ostream& os;// Where the records go
+};
+
+// Record to a stream, starting with a snapshot of the list
+template<typename T, typename Policy>
+RecordingFrankensteinList<T, Policy>::RecordingFrankensteinList(List &list, std::ostream &out)
+        :target(list), os(out)
+{
+    start();
+}
+
+// Record to a file, replacing it
+template<typename T, typename Policy>
+RecordingFrankensteinList<T, Policy>::RecordingFrankensteinList(List &list, const std::string &path)
+        :target(list), file(std::make_unique<std::ofstream>(path, std::ios::binary | std::ios::trunc)), os(*file)
+{
+    if(!*file) {
+        throw std::runtime_error("Failed to open list trace: " + path);
+    }
+    start();
+}
+
+// Write the header and the starting snapshot
+template<typename T, typename Policy>
+void RecordingFrankensteinList<T, Policy>::start() {
+    frankenstein_trace::writeHeader<T>(os);
+    target.save(os);
+    if(!os) {
+        throw std::runtime_error("Failed to write list trace.");
+    }
+}
+
+// Write a record: the value if any as in snapshots, then the numbers as varints
+template<typename T, typename Policy>
+void RecordingFrankensteinList<T, Policy>::record(Op op, const T *val, std::initializer_list<std::uint64_t> numbers) const {
+    os.put(static_cast<char>(op));
+    if(val) {
+        List::writeValue(os, *val);
+    }
+    for(std::uint64_t number : numbers) {
+        frankenstein_trace::writeNumber(os, number);
+    }
+    if(!os) {
+        throw std::runtime_error("Failed to write list trace.");
+    }
+}
+
+// Insert an element at the back
+template<typename T, typename Policy>
+void RecordingFrankensteinList<T, Policy>::push_back(const T &val) {
+    target.push_back(val);
+    record(Op::push_back, &val);
+}
+
+// Insert an element at the front
+template<typename T, typename Policy>
+void RecordingFrankensteinList<T, Policy>::push_front(const T &val) {
+    target.push_front(val);
+    record(Op::push_front, &val);
+}
+
+// Insert an element at a specified position
+template<typename T, typename Policy>
+void RecordingFrankensteinList<T, Policy>::insertAt(const T &val, std::size_t pos) {
+    target.insertAt(val, pos);
+    record(Op::insertAt, &val, {static_cast<std::uint64_t>(pos)});
+}
+
+// Remove the element from the front
+template<typename T, typename Policy>
+void RecordingFrankensteinList<T, Policy>::pop_front() {
+    target.pop_front();
+    record(Op::pop_front);
+}
+
+// Remove the element from the back
+template<typename T, typename Policy>
+void RecordingFrankensteinList<T, Policy>::pop_back() {
+    target.pop_back();
+    record(Op::pop_back);
+}
+
+// Erase the element at a specific position
+template<typename T, typename Policy>
+void RecordingFrankensteinList<T, Policy>::erase(const T &pos) {
+    target.erase(pos);
+    record(Op::erase, nullptr, {static_cast<std::uint64_t>(pos)});
+}
+
+// Erase a range of elements starting at a specific position
+template<typename T, typename Policy>
+void RecordingFrankensteinList<T, Policy>::erase(const T &pos, std::size_t count) {
+    target.erase(pos, count);
+    record(Op::eraseRange, nullptr, {static_cast<std::uint64_t>(pos), static_cast<std::uint64_t>(count)});
+}
+
+// Remove elements with a specific value
+template<typename T, typename Policy>
+void RecordingFrankensteinList<T, Policy>::remove(const T &val) {
+    target.remove(val);
+    record(Op::remove, &val);
+}
+
+// Remove the repeated values
+template<typename T, typename Policy>
+void RecordingFrankensteinList<T, Policy>::unique() {
+    target.unique();
+    record(Op::unique);
+}
+
+// Reverse the order of elements in the list
+template<typename T, typename Policy>
+void RecordingFrankensteinList<T, Policy>::reverse() {
+    target.reverse();
+    record(Op::reverse);
+}
+
+// Sort the list
+template<typename T, typename Policy>
+void RecordingFrankensteinList<T, Policy>::sort() {
+    target.sort();
+    record(Op::sort);
+}
+
+// Resize the list
+template<typename T, typename Policy>
+void RecordingFrankensteinList<T, Policy>::resize(std::size_t newSize) {
+    target.resize(newSize);
+    record(Op::resize, nullptr, {static_cast<std::uint64_t>(newSize)});
+}
+
+// Assign a specified number of elements with the given value
+template<typename T, typename Policy>
+void RecordingFrankensteinList<T, Policy>::assign(std::size_t count, const T &val) {
+    target.assign(count, val);
+    record(Op::assign, &val, {static_cast<std::uint64_t>(count)});
+}
+
+// Check whether a value is present
+template<typename T, typename Policy>
+bool RecordingFrankensteinList<T, Policy>::contains(const T &val) const {
+    bool found = target.contains(val);
+    record(Op::contains, &val);
+    return found;
+}
+
+// Count the occurrences of a value
+template<typename T, typename Policy>
+std::size_t RecordingFrankensteinList<T, Policy>::count(const T &val) const {
+    std::size_t found = target.count(val);
+    record(Op::count, &val);
+    return found;
+}
+
+// Get a pointer to the node at a specified position
+template<typename T, typename Policy>
+typename RecordingFrankensteinList<T, Policy>::NodeType* RecordingFrankensteinList<T, Policy>::getNodeAt(std::size_t pos) const {
+    NodeType* node = target.getNodeAt(pos);
+    record(Op::getNodeAt, nullptr, {static_cast<std::uint64_t>(pos)});
+    return node;
+}
+
+// Visit every value in a print order
+template<typename T, typename Policy>
+template<typename Visit>
+void RecordingFrankensteinList<T, Policy>::scan(PrintOrder order, Visit &&visit) const {
+    target.visitValues(order, visit);
+    record(Op::scan, nullptr, {static_cast<std::uint64_t>(order)});
+}
+
+// The list recorded
+template<typename T, typename Policy>
+typename RecordingFrankensteinList<T, Policy>::List& RecordingFrankensteinList<T, Policy>::list() const {
+    return target;
+}
+
+// Write the buffered records to the stream
+template<typename T, typename Policy>
+void RecordingFrankensteinList<T, Policy>::flush() {
+    if(!os.flush()) {
+        throw std::runtime_error("Failed to write list trace.");
+    }
+}
+
+// Load a trace's starting snapshot into a list and decode its records. The values must have
+// the type the trace was recorded with.
+template<typename T, typename Policy>
+std::vector<typename RecordingFrankensteinList<T, Policy>::Record> RecordingFrankensteinList<T, Policy>::readTrace(std::istream &is, List &list) {
+    frankenstein_trace::Header header = frankenstein_trace::readHeader(is);
+    if(header.valueKind != static_cast<std::uint32_t>(frankenstein_trace::valueKind<T>()) || header.valueBytes != sizeof(T)) {
+        throw std::runtime_error("List trace holds values of a different type.");
+    }
+    list.load(is);
+
+    std::vector<Record> records;
+    for(int tag = is.get(); tag != std::char_traits<char>::eof(); tag = is.get()) {
+        if(tag == 0 || tag >= static_cast<int>(Op::end)) {
+            throw std::runtime_error("Unknown record in list trace.");
+        }
+        Record r;
+        r.op = static_cast<Op>(tag);
+        switch(r.op) {
+            case Op::push_back:
+            case Op::push_front:
+            case Op::remove:
+            case Op::contains:
+            case Op::count:
+                r.value = List::readValue(is);
+                break;
+            case Op::insertAt:
+                r.value = List::readValue(is);
+                r.position = frankenstein_trace::readNumber(is);
+                break;
+            case Op::assign:
+                r.value = List::readValue(is);
+                r.count = frankenstein_trace::readNumber(is);
+                break;
+            case Op::eraseRange:
+                r.position = frankenstein_trace::readNumber(is);
+                r.count = frankenstein_trace::readNumber(is);
+                break;
+            case Op::erase:
+            case Op::resize:
+            case Op::getNodeAt:
+            case Op::scan:
+                r.position = frankenstein_trace::readNumber(is);
+                break;
+            default:
+                break;
+        }
+        records.push_back(std::move(r));
+    }
+    return records;
+}
+
+// Repeat a recorded call, returning what a query found so it cannot be optimized away
+template<typename T, typename Policy>
+std::size_t RecordingFrankensteinList<T, Policy>::apply(List &list, const Record &r) {
+    switch(r.op) {
+        case Op::push_back: list.push_back(r.value); break;
+        case Op::push_front: list.push_front(r.value); break;
+        case Op::insertAt: list.insertAt(r.value, static_cast<std::size_t>(r.position)); break;
+        case Op::pop_front: list.pop_front(); break;
+        case Op::pop_back: list.pop_back(); break;
+        case Op::erase:
+        case Op::eraseRange:
+            if constexpr (std::is_arithmetic<T>::value) {
+                if(r.op == Op::erase) list.erase(static_cast<T>(r.position));
+                else list.erase(static_cast<T>(r.position), static_cast<std::size_t>(r.count));
+                break;
+            } else {
+                throw std::runtime_error("Positional erase needs arithmetic values.");
+            }
+        case Op::remove: list.remove(r.value); break;
+        case Op::unique: list.unique(); break;
+        case Op::reverse: list.reverse(); break;
+        case Op::sort: list.sort(); break;
+        case Op::resize: list.resize(static_cast<std::size_t>(r.position)); break;
+        case Op::assign: list.assign(static_cast<std::size_t>(r.count), r.value); break;
+        case Op::contains: return list.contains(r.value);
+        case Op::count: return list.count(r.value);
+        case Op::getNodeAt: return reinterpret_cast<std::uintptr_t>(list.getNodeAt(static_cast<std::size_t>(r.position)));
+        case Op::scan: {
+            if(r.position > static_cast<std::uint64_t>(PrintOrder::descending)) {
+                throw std::runtime_error("Unknown scan order in list trace.");
+            }
+            std::size_t visited = 0;
+            list.visitValues(static_cast<PrintOrder>(r.position), [&visited](const T&) { ++visited; });
+            return visited;
+        }
+        default:
+            throw std::runtime_error("Unknown record in list trace.");
+    }
+    return 0;
+}
+
+#endif //FRANKENSTEIN_S_LIST_RECORDINGFRANKENSTEINLIST_H
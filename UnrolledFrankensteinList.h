@@ -0,0 +1,161 @@
+#ifndef FRANKENSTEIN_S_LIST_UNROLLEDFRANKENSTEINLIST_H
+#define FRANKENSTEIN_S_LIST_UNROLLEDFRANKENSTEINLIST_H
+#include <iostream>
+#include <memory>
+#include <new>
+#include "FrankensteinMemory.h"
+#include "NodeStorage.h"
+#include <stdexcept>
+
+// Unrolled storage mode of FrankensteinList.
+// Every value is stored once, in an arena, and named by its 32-bit slot number. Both
+// orders are chains of fixed-size chunks of slot numbers instead of one node per
+// element: insertion order in one chain, the sorted view in a second chain whose slots
+// are kept in ascending order of their values. A list pays two slot numbers per value
+// plus two chunk pointers per ChunkSize values, and shifting inside a chunk moves slot
+// numbers, never values.
+template<typename T, std::size_t ChunkSize = 64>
+class UnrolledFrankensteinList {
+    static_assert(ChunkSize >= 2, "ChunkSize must hold at least two values");
+private:
+    // A value in the arena, aligned so that its slot can hold the next free slot number once freed
+    struct alignas(alignof(T) < alignof(std::uint32_t) ? alignof(std::uint32_t) : alignof(T)) Value {
+        explicit Value(const T &v) :val(v) {}
+        T val;
+    };
+    using Values = ArenaNodeStorage<Value>;
+    using slot_type = typename Values::link_type;
+
+    struct Chunk {
+        Chunk* next;// Next chunk in the chain
+        Chunk* prev;// Previous chunk in the chain
+        std::size_t count;// Number of slots in use
+        slot_type slots[ChunkSize];// Arena slots of the values, in the chain's order
+
+        slot_type* data() { return slots; }
+        const slot_type* data() const { return slots; }
+    };
+
+    struct Chain {
+        Chunk* first;// First chunk of the chain
+        Chunk* last;// Last chunk of the chain
+    };
+
+    static Chunk* newChunk(Chain&, Chunk*);// Allocate an empty chunk and link it after the given one
+    static void freeChunk(Chain&, Chunk*) noexcept;// Unlink a chunk and free it, the values stay in the arena
+    static void freeChain(Chain&) noexcept;// Free every chunk of a chain
+    static void insertIntoChunk(Chain&, Chunk*, std::size_t, slot_type);// Insert a value's slot at a position, splitting the chunk when full
+    static void eraseFromChunk(Chain&, Chunk*, std::size_t) noexcept;// Erase the slot at a position, merging sparse neighbours
+    static Chunk* locate(const Chain&, std::size_t&);// Find the chunk holding a position, rewriting it to a slot index
+
+    T& valueOf(slot_type) const noexcept;// The value stored in an arena slot
+    Chunk* lowerBound(const T&, std::size_t&) const;// First sorted position whose value is not smaller, null past the end
+    void PutInSortedOrder(slot_type);// Helper function for inserting a value into the sorted chain
+    void RemoveFromSortedOrder(const T&, slot_type) noexcept;// Helper function for removing a value's slot from the sorted chain, any equal one for null
+    slot_type addValue(const T&);// Store a new value in the arena and the sorted chain
+    void dropValue(slot_type) noexcept;// Take a value out of the sorted chain and destroy it
+    void clear() noexcept;// Helper function for clearing the list
+public:
+
+    // Constructors and destructor
+    UnrolledFrankensteinList();// Default constructor
+    UnrolledFrankensteinList(std::initializer_list<T>);// Constructor with initializer list
+    UnrolledFrankensteinList(const UnrolledFrankensteinList&);// Copy constructor
+    UnrolledFrankensteinList(UnrolledFrankensteinList&&) noexcept;// Move constructor
+    ~UnrolledFrankensteinList();// Destructor
+
+    // Assignment operators
+    UnrolledFrankensteinList& operator=(const UnrolledFrankensteinList&);// Copy assignment operator
+    UnrolledFrankensteinList& operator=(UnrolledFrankensteinList&&) noexcept;// Move assignment operator
+
+    void insertAt(const T&, std::size_t);// Insert an element at a specified position
+    T& getValueAt(std::size_t);// Get a reference to the element at a specified position
+    void push_front(const T&);// Insert an element at the front
+    void pop_front();// Remove the element from the front
+    T& front();// Get a reference to the front element
+    void push_back(const T&);// Insert an element at the back
+    void pop_back();// Remove the element from the back
+    T& back();// Get a reference to the back element
+    bool empty() const;// Check if the list is empty
+    void reverse();// Reverse the order of elements in the list
+    void unique();// Removes all duplicate elements, keeping the first inserted one
+    void remove(const T&);// Remove elements with a specific value
+    void erase(std::size_t);// Erase the element at a specific position
+    void erase(std::size_t, std::size_t);// Erase a range of elements starting at a specific position
+    void sort();// Sort the list
+    void resize(std::size_t);// Resize the list
+    void splice(std::size_t, const UnrolledFrankensteinList&);// Insert elements from another list at the specified position
+    void assign(std::size_t, const T&);// Assign a specified number of elements with the given value
+    bool contains(const T&) const;// Check whether a value is present, using the sorted chunks
+    std::size_t count(const T&) const;// Count the occurrences of a value, using the sorted chunks
+    std::size_t getSize() const;// Get the current size of the list
+    std::size_t getChunkCount() const;// Get the number of chunks in the insertion chain
+    MemoryUsage memory_usage() const;// Bytes of values, chunk headers, empty slots and overhead, one step per chunk
+
+    // Printing functions
+    void printSortedAscendingOrder() const;// Print the list in ascending order
+    void printSortedDescendingOrder() const;// Print the list in descending order
+
+    // Friend function for output stream operator
+    template<typename U, std::size_t N>
+    friend std::ostream& operator<<(std::ostream&, const UnrolledFrankensteinList<U, N>&);
+
+    // Same iterator interface as FrankensteinList: a (chunk, slot) cursor over either chain.
+    // Both chains name the same values; changing one through an iterator leaves it out of
+    // place in the sorted chain, as changing a node's value does in FrankensteinList.
+    enum class IteratorType{head, asc_head};
+    class Iterator {
+    public:
+        Iterator(Chunk*, std::size_t = 0, IteratorType = IteratorType::head, const Values* = nullptr);// Constructor, the arena resolves the slots
+
+        T& operator*();// Dereference operator, returns a reference to the current element
+        T* operator->();// Arrow operator, returns a pointer to the current element
+        Iterator& operator++();// Pre-increment operator, moves the iterator to the next element
+        Iterator operator++(int);// Post-increment operator, moves the iterator to the next element and returns the previous position
+        bool operator==(const Iterator&);// Equality operator, compares iterators for equality
+        bool operator!=(const Iterator&);// Inequality operator, compares iterators for inequality
+    private:
+        Chunk* chunk;// Chunk holding the current element
+        std::size_t slot;// Slot of the current element inside the chunk
+        IteratorType type;// Type of iterator (head or asc_head)
+        const Values* values;// Arena holding the values
+    };
+
+    Iterator begin(IteratorType type = IteratorType::head);// Begin iterator function, returns an iterator pointing to the beginning
+    Iterator end(IteratorType type = IteratorType::head);// End iterator function, returns an iterator pointing to the end
+
+    class ConstIterator {
+    public:
+        ConstIterator(const Chunk*, std::size_t = 0, IteratorType = IteratorType::head, const Values* = nullptr);// Constructor, the arena resolves the slots
+
+        const T& operator*() const;// Const dereference operator, returns a reference to the current element
+        const T* operator->() const;// Const arrow operator, returns a pointer to the current element
+        ConstIterator& operator++();// Pre-increment operator, moves the const iterator to the next element
+        ConstIterator operator++(int);// Post-increment operator, moves the const iterator to the next element and returns the previous position
+        bool operator==(const ConstIterator&) const;// Equality operator, compares const iterators for equality
+        bool operator!=(const ConstIterator&) const;// Inequality operator, compares const iterators for inequality
+    private:
+        const Chunk* chunk;// Chunk holding the current element
+        std::size_t slot;// Slot of the current element inside the chunk
+        IteratorType type;// Type of iterator (head or asc_head)
+        const Values* values;// Arena holding the values
+    };
+
+    ConstIterator cbegin(IteratorType type = IteratorType::head) const;// Const begin iterator function, returns a const iterator pointing to the beginning
+    ConstIterator cend(IteratorType type = IteratorType::head) const;// Const end iterator function, returns a const iterator pointing to the end
+private:
+    Values values;// Owner of the values, each stored once
+    Chain order;// Chunks in insertion order
+    Chain sorted;// Chunks in ascending order
+    std::size_t size;// Current size of the list
+};
+
+// Comparison operators
+template<typename T, std::size_t N>
+bool operator==(const UnrolledFrankensteinList<T, N>&, const UnrolledFrankensteinList<T, N>&);
+template<typename T, std::size_t N>
+bool operator!=(const UnrolledFrankensteinList<T, N>&, const UnrolledFrankensteinList<T, N>&);
+
+#include "UnrolledFrankensteinList.tpp"
+
+#endif //FRANKENSTEIN_S_LIST_UNROLLEDFRANKENSTEINLIST_H
@@ -0,0 +1,880 @@
+#include <algorithm>
+#include <vector>
+
+// Allocate an empty chunk and link it after the given one (at the front for nullptr)
+template<typename T, std::size_t ChunkSize>
+typename UnrolledFrankensteinList<T, ChunkSize>::Chunk*
+UnrolledFrankensteinList<T, ChunkSize>::newChunk(Chain &chain, Chunk *after) {
+    Chunk* chunk = new Chunk;
+    chunk->count = 0;
+    chunk->prev = after;
+    chunk->next = after ? after->next : chain.first;
+    if(chunk->next) {
+        chunk->next->prev = chunk;
+    } else {
+        chain.last = chunk;
+    }
+    if(after) {
+        after->next = chunk;
+    } else {
+        chain.first = chunk;
+    }
+    return chunk;
+}
+
+// Unlink a chunk from its chain and free it; the values it names stay in the arena
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::freeChunk(Chain &chain, Chunk *chunk) noexcept {
+    if(chunk->prev) {
+        chunk->prev->next = chunk->next;
+    } else {
+        chain.first = chunk->next;
+    }
+    if(chunk->next) {
+        chunk->next->prev = chunk->prev;
+    } else {
+        chain.last = chunk->prev;
+    }
+    delete chunk;
+}
+
+// Free every chunk of a chain
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::freeChain(Chain &chain) noexcept {
+    while(chain.first) {
+        freeChunk(chain, chain.first);
+    }
+}
+
+// Insert a value's slot at a position of a chunk, splitting the chunk in half when it is full
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::insertIntoChunk(Chain &chain, Chunk *chunk, std::size_t slot, slot_type id) {
+    if(chunk->count == ChunkSize) {
+        const std::size_t half = ChunkSize / 2;
+        Chunk* upper = newChunk(chain, chunk);
+        std::copy(chunk->data() + half, chunk->data() + ChunkSize, upper->data());
+        upper->count = ChunkSize - half;
+        chunk->count = half;
+        if(slot > half) {
+            chunk = upper;
+            slot -= half;
+        }
+    }
+
+    slot_type* data = chunk->data();
+    std::copy_backward(data + slot, data + chunk->count, data + chunk->count + 1);
+    data[slot] = id;
+    ++chunk->count;
+}
+
+// Erase the slot at a position of a chunk, freeing empty chunks and merging sparse neighbours
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::eraseFromChunk(Chain &chain, Chunk *chunk, std::size_t slot) noexcept {
+    slot_type* data = chunk->data();
+    std::copy(data + slot + 1, data + chunk->count, data + slot);
+    --chunk->count;
+
+    if(chunk->count == 0) {
+        freeChunk(chain, chunk);
+        return;
+    }
+
+    // Keep chunks at least a quarter full so the memory savings survive heavy erasing
+    if(chunk->prev && chunk->prev->count + chunk->count <= ChunkSize / 2) {
+        chunk = chunk->prev;
+    }
+    Chunk* next = chunk->next;
+    if(next && chunk->count + next->count <= ChunkSize / 2) {
+        std::copy(next->data(), next->data() + next->count, chunk->data() + chunk->count);
+        chunk->count += next->count;
+        freeChunk(chain, next);
+    }
+}
+
+// Find the chunk holding a position; the position is rewritten to the slot inside that chunk
+template<typename T, std::size_t ChunkSize>
+typename UnrolledFrankensteinList<T, ChunkSize>::Chunk*
+UnrolledFrankensteinList<T, ChunkSize>::locate(const Chain &chain, std::size_t &pos) {
+    Chunk* curr = chain.first;
+    while(pos >= curr->count) {
+        pos -= curr->count;
+        curr = curr->next;
+    }
+    return curr;
+}
+
+// The value stored in an arena slot
+template<typename T, std::size_t ChunkSize>
+T& UnrolledFrankensteinList<T, ChunkSize>::valueOf(slot_type id) const noexcept {
+    return values.get(id)->val;
+}
+
+// First sorted position whose value is not smaller: skip whole chunks by their largest value,
+// then binary search inside the chunk. The slot inside the chunk goes to pos.
+template<typename T, std::size_t ChunkSize>
+typename UnrolledFrankensteinList<T, ChunkSize>::Chunk*
+UnrolledFrankensteinList<T, ChunkSize>::lowerBound(const T &val, std::size_t &pos) const {
+    Chunk* curr = sorted.first;
+    while(curr && valueOf(curr->data()[curr->count - 1]) < val) {
+        curr = curr->next;
+    }
+    if(curr) {
+        const slot_type* data = curr->data();
+        pos = std::lower_bound(data, data + curr->count, val, [this](slot_type id, const T &v) {
+            return valueOf(id) < v;
+        }) - data;
+    }
+    return curr;
+}
+
+// Helper function for inserting a value's slot into the sorted chain, in front of its equals
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::PutInSortedOrder(slot_type id) {
+    std::size_t slot = 0;
+    Chunk* curr = lowerBound(valueOf(id), slot);
+
+    if(!curr) {
+        Chunk* last = sorted.last ? sorted.last : newChunk(sorted, nullptr);
+        insertIntoChunk(sorted, last, last->count, id);
+    } else if(slot == 0 && curr->prev && curr->prev->count < ChunkSize) {
+        // Append to the previous chunk instead of splitting this one
+        insertIntoChunk(sorted, curr->prev, curr->prev->count, id);
+    } else {
+        insertIntoChunk(sorted, curr, slot, id);
+    }
+}
+
+// Helper function for removing a value's slot from the sorted chain: the slot is searched
+// among the run of values equal to it, for null the first of them goes. A value changed
+// through a reference sits out of place, so a slot missing from its run is searched chunk by chunk.
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::RemoveFromSortedOrder(const T &val, slot_type id) noexcept {
+    std::size_t slot = 0;
+    Chunk* curr = lowerBound(val, slot);
+    while(curr) {
+        if(slot == curr->count) {
+            curr = curr->next;
+            slot = 0;
+            continue;
+        }
+        slot_type found = curr->data()[slot];
+        if(!(valueOf(found) == val)) break;
+        if(id == Values::null || found == id) {
+            eraseFromChunk(sorted, curr, slot);
+            return;
+        }
+        ++slot;
+    }
+    if(id == Values::null) return;
+
+    for(curr = sorted.first; curr; curr = curr->next) {
+        const slot_type* data = curr->data();
+        const slot_type* found = std::find(data, data + curr->count, id);
+        if(found != data + curr->count) {
+            eraseFromChunk(sorted, curr, found - data);
+            return;
+        }
+    }
+}
+
+// Store a new value in the arena and put it into the sorted chain; the caller links the slot into the insertion chain
+template<typename T, std::size_t ChunkSize>
+typename UnrolledFrankensteinList<T, ChunkSize>::slot_type UnrolledFrankensteinList<T, ChunkSize>::addValue(const T &val) {
+    slot_type id = values.create(val);
+    try {
+        PutInSortedOrder(id);
+    } catch(...) {
+        values.destroy(id);
+        throw;
+    }
+    return id;
+}
+
+// Take a value out of the sorted chain and destroy it, once its slot left the insertion chain
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::dropValue(slot_type id) noexcept {
+    RemoveFromSortedOrder(valueOf(id), id);
+    values.destroy(id);
+}
+
+// Helper function for clearing the list
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::clear() noexcept {
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+        for(const Chunk* c = order.first; c; c = c->next) {
+            for(std::size_t i = 0; i < c->count; ++i) {
+                values.destroy(c->data()[i]);
+            }
+        }
+    }
+    values.dropAll();
+    freeChain(order);
+    freeChain(sorted);
+    size = 0;
+}
+
+// Default constructor
+template<typename T, std::size_t ChunkSize>
+UnrolledFrankensteinList<T, ChunkSize>::UnrolledFrankensteinList()
+        :order{nullptr, nullptr}, sorted{nullptr, nullptr}, size(0)
+{
+}
+
+// Constructor with initializer list
+template<typename T, std::size_t ChunkSize>
+UnrolledFrankensteinList<T, ChunkSize>::UnrolledFrankensteinList(std::initializer_list<T> list)
+        :order{nullptr, nullptr}, sorted{nullptr, nullptr}, size(0)
+{
+    for(const T& val : list) {
+        push_back(val);
+    }
+}
+
+// Copy constructor, copies both chains chunk by chunk without comparing any values: the
+// values are copied along the insertion chain, and the sorted chain is translated to the new slots
+template<typename T, std::size_t ChunkSize>
+UnrolledFrankensteinList<T, ChunkSize>::UnrolledFrankensteinList(const UnrolledFrankensteinList &oth)
+        :order{nullptr, nullptr}, sorted{nullptr, nullptr}, size(0)
+{
+    try {
+        std::vector<slot_type> copyOf(oth.values.footprint(oth.size).handedOut, Values::null);
+        for(const Chunk* c = oth.order.first; c; c = c->next) {
+            Chunk* chunk = newChunk(order, order.last);
+            for(std::size_t i = 0; i < c->count; ++i) {
+                slot_type from = c->data()[i];
+                copyOf[from] = values.create(oth.valueOf(from));
+                chunk->data()[chunk->count++] = copyOf[from];
+            }
+        }
+        for(const Chunk* c = oth.sorted.first; c; c = c->next) {
+            Chunk* chunk = newChunk(sorted, sorted.last);
+            for(std::size_t i = 0; i < c->count; ++i) {
+                chunk->data()[i] = copyOf[c->data()[i]];
+            }
+            chunk->count = c->count;
+        }
+    } catch(...) {
+        // Every value copied so far is in the insertion chain, so clearing destroys it
+        clear();
+        throw;
+    }
+    size = oth.size;
+}
+
+// Move constructor
+template<typename T, std::size_t ChunkSize>
+UnrolledFrankensteinList<T, ChunkSize>::UnrolledFrankensteinList(UnrolledFrankensteinList &&oth) noexcept
+        :values(std::move(oth.values)), order(oth.order), sorted(oth.sorted), size(oth.size)
+{
+    oth.order = {nullptr, nullptr};
+    oth.sorted = {nullptr, nullptr};
+    oth.size = 0;
+}
+
+// Destructor
+template<typename T, std::size_t ChunkSize>
+UnrolledFrankensteinList<T, ChunkSize>::~UnrolledFrankensteinList() {
+    clear();
+}
+
+// Copy assignment operator
+template<typename T, std::size_t ChunkSize>
+UnrolledFrankensteinList<T, ChunkSize>& UnrolledFrankensteinList<T, ChunkSize>::operator=(const UnrolledFrankensteinList &oth) {
+    if(this == &oth) {
+        return *this; // Avoid self-assignment
+    }
+    UnrolledFrankensteinList tmp(oth);
+    *this = std::move(tmp);
+    return *this;
+}
+
+// Move assignment operator
+template<typename T, std::size_t ChunkSize>
+UnrolledFrankensteinList<T, ChunkSize>& UnrolledFrankensteinList<T, ChunkSize>::operator=(UnrolledFrankensteinList &&oth) noexcept {
+    if(this == &oth) {
+        return *this; // Avoid self-assignment
+    }
+    clear();
+
+    values.swap(oth.values);
+    order = oth.order;
+    sorted = oth.sorted;
+    size = oth.size;
+
+    oth.order = {nullptr, nullptr};
+    oth.sorted = {nullptr, nullptr};
+    oth.size = 0;
+    return *this;
+}
+
+// Insert an element at a specified position
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::insertAt(const T &val, std::size_t pos) {
+    if(pos > size) {
+        throw std::out_of_range("Position is out of range.");
+    }
+
+    if(pos == size) {
+        return push_back(val);
+    }
+
+    Chunk* chunk = locate(order, pos);
+    slot_type id = addValue(val);
+    try {
+        if(pos == 0 && chunk->prev && chunk->prev->count < ChunkSize) {
+            insertIntoChunk(order, chunk->prev, chunk->prev->count, id);
+        } else {
+            insertIntoChunk(order, chunk, pos, id);
+        }
+    } catch(...) {
+        dropValue(id);
+        throw;
+    }
+    ++size;
+}
+
+// Get a reference to the element at a specified position
+template<typename T, std::size_t ChunkSize>
+T& UnrolledFrankensteinList<T, ChunkSize>::getValueAt(std::size_t pos) {
+    if(pos >= size) {
+        throw std::out_of_range("Position is out of range.");
+    }
+    Chunk* chunk = locate(order, pos);
+    return valueOf(chunk->data()[pos]);
+}
+
+// Insert an element at the front
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::push_front(const T &val) {
+    slot_type id = addValue(val);
+    try {
+        Chunk* first = order.first ? order.first : newChunk(order, nullptr);
+        insertIntoChunk(order, first, 0, id);
+    } catch(...) {
+        dropValue(id);
+        throw;
+    }
+    ++size;
+}
+
+// Remove the element from the front
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::pop_front() {
+    if(!size) {
+        throw std::runtime_error("List is empty. Cannot pop_front.");
+    }
+    slot_type id = order.first->data()[0];
+    eraseFromChunk(order, order.first, 0);
+    dropValue(id);
+    --size;
+}
+
+// Get a reference to the front element
+template<typename T, std::size_t ChunkSize>
+T& UnrolledFrankensteinList<T, ChunkSize>::front() {
+    if(!size) {
+        throw std::runtime_error("List is empty. Cannot access front element.");
+    }
+    return valueOf(order.first->data()[0]);
+}
+
+// Insert an element at the back
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::push_back(const T &val) {
+    slot_type id = addValue(val);
+    try {
+        Chunk* last = order.last ? order.last : newChunk(order, nullptr);
+        if(last->count == ChunkSize) {
+            // Start a fresh chunk instead of splitting, so appends keep chunks full
+            last = newChunk(order, last);
+        }
+        insertIntoChunk(order, last, last->count, id);
+    } catch(...) {
+        dropValue(id);
+        throw;
+    }
+    ++size;
+}
+
+// Remove the element from the back
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::pop_back() {
+    if(!size) {
+        throw std::runtime_error("List is empty. Cannot pop_back.");
+    }
+    Chunk* last = order.last;
+    slot_type id = last->data()[last->count - 1];
+    eraseFromChunk(order, last, last->count - 1);
+    dropValue(id);
+    --size;
+}
+
+// Get a reference to the back element
+template<typename T, std::size_t ChunkSize>
+T& UnrolledFrankensteinList<T, ChunkSize>::back() {
+    if(!size) {
+        throw std::runtime_error("List is empty. Cannot access back element.");
+    }
+    return valueOf(order.last->data()[order.last->count - 1]);
+}
+
+// Check if the list is empty
+template<typename T, std::size_t ChunkSize>
+bool UnrolledFrankensteinList<T, ChunkSize>::empty() const {
+    return size == 0;
+}
+
+// Reverse the order of elements in the list
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::reverse() {
+    Chunk* curr = order.first;
+    while(curr) {
+        std::reverse(curr->data(), curr->data() + curr->count);
+        std::swap(curr->next, curr->prev);
+        curr = curr->prev;
+    }
+    std::swap(order.first, order.last);
+}
+
+// Remove duplicate elements, keeping the first one in insertion order
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::unique() {
+    if(size <= 1) return;
+
+    // One slot per distinct value in ascending order, straight from the sorted chain
+    std::vector<slot_type> distinct;
+    for(const Chunk* c = sorted.first; c; c = c->next) {
+        for(std::size_t i = 0; i < c->count; ++i) {
+            if(distinct.empty() || valueOf(distinct.back()) != valueOf(c->data()[i])) {
+                distinct.push_back(c->data()[i]);
+            }
+        }
+    }
+    if(distinct.size() == size) return;
+
+    // Rebuild both chains densely packed before anything is destroyed
+    Chain kept{nullptr, nullptr};
+    Chain keptSorted{nullptr, nullptr};
+    std::vector<slot_type> survivor(distinct.size(), Values::null);
+    std::vector<slot_type> doomed;
+    try {
+        doomed.reserve(size - distinct.size());
+        for(Chunk* c = order.first; c; c = c->next) {
+            for(std::size_t i = 0; i < c->count; ++i) {
+                slot_type id = c->data()[i];
+                std::size_t idx = std::lower_bound(distinct.begin(), distinct.end(), valueOf(id), [this](slot_type d, const T &v) {
+                    return valueOf(d) < v;
+                }) - distinct.begin();
+                if(survivor[idx] != Values::null) {
+                    doomed.push_back(id);
+                    continue;
+                }
+                survivor[idx] = id;
+                if(!kept.last || kept.last->count == ChunkSize) {
+                    newChunk(kept, kept.last);
+                }
+                kept.last->data()[kept.last->count++] = id;
+            }
+        }
+        for(slot_type id : survivor) {
+            if(!keptSorted.last || keptSorted.last->count == ChunkSize) {
+                newChunk(keptSorted, keptSorted.last);
+            }
+            keptSorted.last->data()[keptSorted.last->count++] = id;
+        }
+    } catch(...) {
+        freeChain(kept);
+        freeChain(keptSorted);
+        throw;
+    }
+
+    freeChain(order);
+    freeChain(sorted);
+    order = kept;
+    sorted = keptSorted;
+    for(slot_type id : doomed) {
+        values.destroy(id);
+    }
+    size = distinct.size();
+}
+
+// Function to remove all occurrences of a value from the list
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::remove(const T &val) {
+    const T target(val);// The argument may refer to an element that is about to go
+
+    // Insertion chain: compact every chunk in place, the matches are destroyed at the end
+    std::vector<slot_type> doomed;
+    Chunk* curr = order.first;
+    while(curr) {
+        Chunk* next = curr->next;
+        slot_type* data = curr->data();
+        std::size_t kept = 0;
+        for(std::size_t i = 0; i < curr->count; ++i) {
+            if(valueOf(data[i]) == target) {
+                doomed.push_back(data[i]);
+                continue;
+            }
+            data[kept++] = data[i];
+        }
+        curr->count = kept;
+        if(!kept) {
+            freeChunk(order, curr);
+        }
+        curr = next;
+    }
+    if(doomed.empty()) return;
+
+    // Sorted chain: compact it the same way, before the values go
+    curr = sorted.first;
+    while(curr) {
+        Chunk* next = curr->next;
+        slot_type* data = curr->data();
+        std::size_t kept = 0;
+        for(std::size_t i = 0; i < curr->count; ++i) {
+            if(!(valueOf(data[i]) == target)) {
+                data[kept++] = data[i];
+            }
+        }
+        curr->count = kept;
+        if(!kept) {
+            freeChunk(sorted, curr);
+        }
+        curr = next;
+    }
+    for(slot_type id : doomed) {
+        values.destroy(id);
+    }
+    size -= doomed.size();
+}
+
+// Function to erase an element at a specific position
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::erase(std::size_t pos) {
+    if(pos >= size) {
+        throw std::out_of_range("Position is out of range.");
+    }
+    Chunk* chunk = locate(order, pos);
+    slot_type id = chunk->data()[pos];
+    eraseFromChunk(order, chunk, pos);
+    dropValue(id);
+    --size;
+}
+
+// Function to erase a range of elements starting from a specific position
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::erase(std::size_t pos, std::size_t count) {
+    if(pos > size || pos + count > size) {
+        throw std::out_of_range("Position is out of range.");
+    }
+    while(count) {
+        erase(pos);
+        --count;
+    }
+}
+
+// Function to sort the list, the insertion chain becomes a copy of the sorted chain's slots
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::sort() {
+    Chain copy{nullptr, nullptr};
+    try {
+        for(const Chunk* c = sorted.first; c; c = c->next) {
+            Chunk* chunk = newChunk(copy, copy.last);
+            std::copy(c->data(), c->data() + c->count, chunk->data());
+            chunk->count = c->count;
+        }
+    } catch(...) {
+        freeChain(copy);
+        throw;
+    }
+    freeChain(order);
+    order = copy;
+}
+
+// Resize the list, new elements are value-initialized
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::resize(std::size_t newSize) {
+    while(size > newSize) {
+        pop_back();
+    }
+    while(size < newSize) {
+        push_back(T());
+    }
+}
+
+// Insert elements from another list at the specified position, keeping their order
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::splice(std::size_t pos, const UnrolledFrankensteinList &list) {
+    if(pos > size) {
+        throw std::out_of_range("Position is out of range.");
+    }
+    if(this == &list) {
+        UnrolledFrankensteinList copy(list);
+        return splice(pos, copy);
+    }
+    for(ConstIterator it = list.cbegin(); it != list.cend(); ++it) {
+        insertAt(*it, pos++);
+    }
+}
+
+// Assign a specified number of elements with the given value.
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::assign(std::size_t count, const T &val) {
+    const T copy(val);
+    clear();
+    while(count) {
+        push_back(copy);
+        --count;
+    }
+}
+
+// Check whether a value is present
+template<typename T, std::size_t ChunkSize>
+bool UnrolledFrankensteinList<T, ChunkSize>::contains(const T &val) const {
+    return count(val) != 0;
+}
+
+// Count the occurrences of a value, skipping chunks by their bounds
+template<typename T, std::size_t ChunkSize>
+std::size_t UnrolledFrankensteinList<T, ChunkSize>::count(const T &val) const {
+    std::size_t slot = 0;
+    const Chunk* curr = lowerBound(val, slot);
+
+    std::size_t result = 0;
+    while(curr && !(val < valueOf(curr->data()[slot]))) {
+        auto upper = std::upper_bound(curr->data() + slot, curr->data() + curr->count, val, [this](const T &v, slot_type id) {
+            return v < valueOf(id);
+        });
+        result += upper - (curr->data() + slot);
+        curr = curr->next;
+        slot = 0;
+    }
+    return result;
+}
+
+// Get the current size of the list
+template<typename T, std::size_t ChunkSize>
+std::size_t UnrolledFrankensteinList<T, ChunkSize>::getSize() const {
+    return size;
+}
+
+// Get the number of chunks in the insertion chain
+template<typename T, std::size_t ChunkSize>
+std::size_t UnrolledFrankensteinList<T, ChunkSize>::getChunkCount() const {
+    std::size_t count = 0;
+    for(const Chunk* c = order.first; c; c = c->next) {
+        ++count;
+    }
+    return count;
+}
+
+// Bytes of values, chunk headers, empty slots and overhead. Every value is stored once in the
+// arena; both chains pay a slot number per value.
+template<typename T, std::size_t ChunkSize>
+MemoryUsage UnrolledFrankensteinList<T, ChunkSize>::memory_usage() const {
+    MemoryUsage usage;
+    usage.nodes = size;
+    StorageFootprint arena = values.footprint(size);
+    usage.valueBytes = size * sizeof(T);
+    usage.linkBytes = size * (sizeof(Value) - sizeof(T));
+    usage.freeBytes = (arena.handedOut - size) * sizeof(Value);
+    usage.slackBytes = (arena.slots - arena.handedOut) * sizeof(Value) + arena.allocatorBytes;
+    for(const Chain* chain : {&order, &sorted}) {
+        for(const Chunk* c = chain->first; c; c = c->next) {
+            usage.linkBytes += sizeof(Chunk) - sizeof(slot_type) * (ChunkSize - c->count);
+            usage.slackBytes += (ChunkSize - c->count) * sizeof(slot_type)
+                                + frankenstein_memory::allocationOverhead(std::pmr::new_delete_resource(), sizeof(Chunk));
+        }
+    }
+    usage.overheadBytes = sizeof(*this) + arena.tableBytes;
+    return usage;
+}
+
+// Print the list in ascending order
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::printSortedAscendingOrder() const {
+    for(const Chunk* c = sorted.first; c; c = c->next) {
+        for(std::size_t i = 0; i < c->count; ++i) {
+            std::cout << valueOf(c->data()[i]) << " ";
+        }
+    }
+    std::cout << std::endl;
+}
+
+// Print the list in descending order
+template<typename T, std::size_t ChunkSize>
+void UnrolledFrankensteinList<T, ChunkSize>::printSortedDescendingOrder() const {
+    for(const Chunk* c = sorted.last; c; c = c->prev) {
+        for(std::size_t i = c->count; i > 0; --i) {
+            std::cout << valueOf(c->data()[i - 1]) << " ";
+        }
+    }
+    std::cout << std::endl;
+}
+
+// Overload the output stream operator for printing the list
+template<typename T, std::size_t ChunkSize>
+std::ostream &operator<<(std::ostream &os, const UnrolledFrankensteinList<T, ChunkSize> &list) {
+    for(auto it = list.cbegin(); it != list.cend(); ++it) {
+        os << *it << " ";
+    }
+    os << std::endl;
+    return os;
+}
+
+// Iterator constructor
+template<typename T, std::size_t ChunkSize>
+UnrolledFrankensteinList<T, ChunkSize>::Iterator::Iterator(Chunk *c, std::size_t s, IteratorType t, const Values *v)
+    :chunk(c), slot(s), type(t), values(v)
+{
+}
+
+// Dereference operator for Iterator (non-const)
+template<typename T, std::size_t ChunkSize>
+T& UnrolledFrankensteinList<T, ChunkSize>::Iterator::operator*() {
+    if(!chunk) {
+        throw std::runtime_error("Iterator is not dereferencable.");
+    }
+    return values->get(chunk->data()[slot])->val;
+}
+
+// Arrow operator for Iterator (non-const)
+template<typename T, std::size_t ChunkSize>
+T* UnrolledFrankensteinList<T, ChunkSize>::Iterator::operator->() {
+    if(!chunk) {
+        throw std::runtime_error("Iterator is not dereferencable.");
+    }
+    return &values->get(chunk->data()[slot])->val;
+}
+
+// Prefix increment operator for Iterator
+template<typename T, std::size_t ChunkSize>
+typename UnrolledFrankensteinList<T, ChunkSize>::Iterator& UnrolledFrankensteinList<T, ChunkSize>::Iterator::operator++() {
+    if(++slot == chunk->count) {
+        chunk = chunk->next;
+        slot = 0;
+    }
+    return *this;
+}
+
+// Postfix increment operator for Iterator
+template<typename T, std::size_t ChunkSize>
+typename UnrolledFrankensteinList<T, ChunkSize>::Iterator UnrolledFrankensteinList<T, ChunkSize>::Iterator::operator++(int) {
+    Iterator tmp = *this;
+    ++(*this);
+    return tmp;
+}
+
+// Equality comparison operator for Iterator
+template<typename T, std::size_t ChunkSize>
+bool UnrolledFrankensteinList<T, ChunkSize>::Iterator::operator==(const Iterator &oth) {
+    return chunk == oth.chunk && slot == oth.slot;
+}
+
+// Inequality comparison operator for Iterator
+template<typename T, std::size_t ChunkSize>
+bool UnrolledFrankensteinList<T, ChunkSize>::Iterator::operator!=(const Iterator &oth) {
+    return !(*this == oth);
+}
+
+// Iterator begin function
+template<typename T, std::size_t ChunkSize>
+typename UnrolledFrankensteinList<T, ChunkSize>::Iterator UnrolledFrankensteinList<T, ChunkSize>::begin(IteratorType type) {
+    return Iterator((type == IteratorType::head) ? order.first : sorted.first, 0, type, &values);
+}
+
+// Iterator end function
+template<typename T, std::size_t ChunkSize>
+typename UnrolledFrankensteinList<T, ChunkSize>::Iterator UnrolledFrankensteinList<T, ChunkSize>::end(IteratorType type) {
+    return Iterator(nullptr, 0, type, &values);
+}
+
+// ConstIterator constructor
+template<typename T, std::size_t ChunkSize>
+UnrolledFrankensteinList<T, ChunkSize>::ConstIterator::ConstIterator(const Chunk *c, std::size_t s, IteratorType t, const Values *v)
+    :chunk(c), slot(s), type(t), values(v)
+{
+}
+
+// Dereference operator for ConstIterator (const)
+template<typename T, std::size_t ChunkSize>
+const T& UnrolledFrankensteinList<T, ChunkSize>::ConstIterator::operator*() const {
+    if(!chunk) {
+        throw std::runtime_error("Iterator is not dereferencable.");
+    }
+    return values->get(chunk->data()[slot])->val;
+}
+
+// Arrow operator for ConstIterator (const)
+template<typename T, std::size_t ChunkSize>
+const T* UnrolledFrankensteinList<T, ChunkSize>::ConstIterator::operator->() const {
+    if(!chunk) {
+        throw std::runtime_error("Iterator is not dereferencable.");
+    }
+    return &values->get(chunk->data()[slot])->val;
+}
+
+// Prefix increment operator for ConstIterator
+template<typename T, std::size_t ChunkSize>
+typename UnrolledFrankensteinList<T, ChunkSize>::ConstIterator& UnrolledFrankensteinList<T, ChunkSize>::ConstIterator::operator++() {
+    if(++slot == chunk->count) {
+        chunk = chunk->next;
+        slot = 0;
+    }
+    return *this;
+}
+
+// Postfix increment operator for ConstIterator
+template<typename T, std::size_t ChunkSize>
+typename UnrolledFrankensteinList<T, ChunkSize>::ConstIterator UnrolledFrankensteinList<T, ChunkSize>::ConstIterator::operator++(int) {
+    ConstIterator tmp = *this;
+    ++(*this);
+    return tmp;
+}
+
+// Equality comparison operator for ConstIterator
+template<typename T, std::size_t ChunkSize>
+bool UnrolledFrankensteinList<T, ChunkSize>::ConstIterator::operator==(const ConstIterator &oth) const {
+    return chunk == oth.chunk && slot == oth.slot;
+}
+
+// Inequality comparison operator for ConstIterator
+template<typename T, std::size_t ChunkSize>
+bool UnrolledFrankensteinList<T, ChunkSize>::ConstIterator::operator!=(const ConstIterator &oth) const {
+    return !(*this == oth);
+}
+
+// ConstIterator begin function
+template<typename T, std::size_t ChunkSize>
+typename UnrolledFrankensteinList<T, ChunkSize>::ConstIterator UnrolledFrankensteinList<T, ChunkSize>::cbegin(IteratorType type) const {
+    return ConstIterator((type == IteratorType::head) ? order.first : sorted.first, 0, type, &values);
+}
+
+// ConstIterator end function
+template<typename T, std::size_t ChunkSize>
+typename UnrolledFrankensteinList<T, ChunkSize>::ConstIterator UnrolledFrankensteinList<T, ChunkSize>::cend(IteratorType type) const {
+    return ConstIterator(nullptr, 0, type, &values);
+}
+
+// Equality operator
+template<typename T, std::size_t N>
+bool operator==(const UnrolledFrankensteinList<T, N>& first, const UnrolledFrankensteinList<T, N>& second) {
+    if(first.getSize() != second.getSize()) return false;
+
+    auto it1 = first.cbegin();
+    auto it2 = second.cbegin();
+    while(it1 != first.cend()) {
+        if(*it1 != *it2) {
+            return false;
+        }
+        ++it1;
+        ++it2;
+    }
+    return true;
+}
+
+// Inequality operator
+template<typename T, std::size_t N>
+bool operator!=(const UnrolledFrankensteinList<T, N>& first, const UnrolledFrankensteinList<T, N>& second) {
+    return !(first == second);
+}
@@ -0,0 +1,422 @@
+// Microbenchmarks of the public FrankensteinList operations against std::list, std::multiset and
+// a std::list + std::multiset pair, over sizes, input orders and payload types. Results go out as JSON.
+// Usage: frankenstein_bench [--max-size N] [--budget seconds] [--max-bytes N] [--filter text] [--out file]
+// A series stops growing once the next size is predicted to take longer than the budget or to need
+// more memory than --max-bytes, so quadratic cases end early instead of running for hours.
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <optional>
+#include <random>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "../FrankensteinList.h"
+
+using Clock = std::chrono::steady_clock;
+
+// Keep a value alive without the compiler seeing what is done with it
+template<typename V>
+static void consume(const V &val) {
+    asm volatile("" : : "g"(&val) : "memory");
+}
+
+// Payload of 200 bytes ordered by its key
+struct Record {
+    std::uint64_t key;
+    char pad[192];
+};
+static bool operator<(const Record &a, const Record &b) { return a.key < b.key; }
+static bool operator==(const Record &a, const Record &b) { return a.key == b.key; }
+
+// Payload of the given type for a key, ordered like the keys
+template<typename T>
+static T payload(std::uint64_t key) {
+    if constexpr (std::is_same<T, int>::value) {
+        return static_cast<int>(key);
+    } else if constexpr (std::is_same<T, std::string>::value) {
+        std::string text = std::to_string(key);
+        return std::string(24 - text.size(), '0') + text;// Zero padded past the small string buffer
+    } else {
+        Record r{};
+        r.key = key;
+        std::memset(r.pad, static_cast<int>(key & 0x7f), sizeof(r.pad));
+        return r;
+    }
+}
+
+template<typename T> constexpr const char* payloadName();
+template<> constexpr const char* payloadName<int>() { return "int"; }
+template<> constexpr const char* payloadName<std::string>() { return "string"; }
+template<> constexpr const char* payloadName<Record>() { return "record200"; }
+
+// Input orders
+enum class Input{random, sorted, reversed, duplicates};
+static const char* inputName(Input input) {
+    switch(input) {
+        case Input::random: return "random";
+        case Input::sorted: return "sorted";
+        case Input::reversed: return "reverse_sorted";
+        default: return "duplicates";
+    }
+}
+
+static std::vector<std::uint64_t> keys(Input input, std::size_t n, std::uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<std::uint64_t> out(n);
+    for(std::uint64_t& key : out) {
+        key = (input == Input::duplicates) ? rng() % 16 : rng() % 1000000000;
+    }
+    if(input == Input::sorted) std::sort(out.begin(), out.end());
+    if(input == Input::reversed) std::sort(out.rbegin(), out.rend());
+    return out;
+}
+
+// The containers behind one interface. Positions follow insertion order where the
+// container has one and sorted order otherwise.
+template<typename T>
+class FrankensteinAdapter {
+public:
+    static constexpr const char* name = "FrankensteinList";
+    static constexpr bool positional_erase = std::is_arithmetic<T>::value;// erase(const T&) takes the position as a T
+
+    void push_back(const T &val) { list.push_back(val); }
+    void push_front(const T &val) { list.push_front(val); }
+    void insertAt(const T &val, std::size_t pos) { list.insertAt(val, pos); }
+    const T& at(std::size_t pos) { return list.getNodeAt(pos)->val; }
+    void erase(std::size_t pos) {
+        if constexpr (positional_erase) list.erase(static_cast<T>(pos));
+    }
+    void remove(const T &val) { list.remove(val); }
+    void unique() { list.unique(); }
+    void merge(FrankensteinAdapter &oth) { list.merge(oth.list); }
+    void splice(std::size_t pos, const FrankensteinAdapter &oth) { list.splice(pos, oth.list); }
+    void sort() { list.sort(); }
+    template<typename Visit>
+    void sorted(Visit &&visit) const {
+        using List = FrankensteinList<T>;
+        for(auto it = list.cbegin(List::IteratorType::asc_head); it != list.cend(); ++it) visit(*it);
+    }
+    std::size_t size() const { return static_cast<std::size_t>(list.getSize()); }
+private:
+    FrankensteinList<T> list;
+};
+
+template<typename T>
+class ListAdapter {
+public:
+    static constexpr const char* name = "std::list";
+    static constexpr bool positional_erase = true;
+
+    void push_back(const T &val) { list.push_back(val); }
+    void push_front(const T &val) { list.push_front(val); }
+    void insertAt(const T &val, std::size_t pos) { list.insert(std::next(list.begin(), pos), val); }
+    const T& at(std::size_t pos) { return *std::next(list.begin(), pos); }
+    void erase(std::size_t pos) { list.erase(std::next(list.begin(), pos)); }
+    void remove(const T &val) { list.remove(val); }
+    void unique() {// Keep the first occurrence of every value, as FrankensteinList::unique() keeps one
+        std::set<T> seen;
+        list.remove_if([&seen](const T& val) { return !seen.insert(val).second; });
+    }
+    void merge(ListAdapter &oth) { list.splice(list.end(), oth.list); }
+    void splice(std::size_t pos, const ListAdapter &oth) { list.insert(std::next(list.begin(), pos), oth.list.begin(), oth.list.end()); }
+    void sort() { list.sort(); }
+    template<typename Visit>
+    void sorted(Visit &&visit) const {// No sorted view: sort pointers to the values
+        std::vector<const T*> view;
+        view.reserve(list.size());
+        for(const T& val : list) view.push_back(&val);
+        std::sort(view.begin(), view.end(), [](const T* a, const T* b) { return *a < *b; });
+        for(const T* val : view) visit(*val);
+    }
+    std::size_t size() const { return list.size(); }
+private:
+    std::list<T> list;
+};
+
+template<typename T>
+class MultisetAdapter {
+public:
+    static constexpr const char* name = "std::multiset";
+    static constexpr bool positional_erase = true;
+
+    void push_back(const T &val) { set.emplace_hint(set.end(), val); }
+    void push_front(const T &val) { set.emplace_hint(set.begin(), val); }
+    void insertAt(const T &val, std::size_t) { set.insert(val); }
+    const T& at(std::size_t pos) { return *std::next(set.begin(), pos); }
+    void erase(std::size_t pos) { set.erase(std::next(set.begin(), pos)); }
+    void remove(const T &val) { set.erase(val); }
+    void unique() {
+        for(auto it = set.begin(); it != set.end(); ) {
+            auto last = set.upper_bound(*it);
+            it = set.erase(std::next(it), last);
+        }
+    }
+    void merge(MultisetAdapter &oth) { set.merge(oth.set); }
+    void splice(std::size_t, const MultisetAdapter &oth) { set.insert(oth.set.begin(), oth.set.end()); }
+    void sort() {}
+    template<typename Visit>
+    void sorted(Visit &&visit) const {
+        for(const T& val : set) visit(val);
+    }
+    std::size_t size() const { return set.size(); }
+private:
+    std::multiset<T> set;
+};
+
+// What FrankensteinList replaces: a list for insertion order next to a multiset for sorted order
+template<typename T>
+class PairAdapter {
+public:
+    static constexpr const char* name = "std::list+std::multiset";
+    static constexpr bool positional_erase = true;
+
+    void push_back(const T &val) { list.push_back(val); set.insert(val); }
+    void push_front(const T &val) { list.push_front(val); set.insert(val); }
+    void insertAt(const T &val, std::size_t pos) { list.insert(std::next(list.begin(), pos), val); set.insert(val); }
+    const T& at(std::size_t pos) { return *std::next(list.begin(), pos); }
+    void erase(std::size_t pos) {
+        auto it = std::next(list.begin(), pos);
+        set.erase(set.find(*it));
+        list.erase(it);
+    }
+    void remove(const T &val) { list.remove(val); set.erase(val); }
+    void unique() {
+        std::set<T> seen;
+        list.remove_if([&seen](const T& val) { return !seen.insert(val).second; });
+        for(auto it = set.begin(); it != set.end(); ) {
+            auto last = set.upper_bound(*it);
+            it = set.erase(std::next(it), last);
+        }
+    }
+    void merge(PairAdapter &oth) { list.splice(list.end(), oth.list); set.merge(oth.set); }
+    void splice(std::size_t pos, const PairAdapter &oth) {
+        list.insert(std::next(list.begin(), pos), oth.list.begin(), oth.list.end());
+        set.insert(oth.list.begin(), oth.list.end());
+    }
+    void sort() { list.sort(); }
+    template<typename Visit>
+    void sorted(Visit &&visit) const {
+        for(const T& val : set) visit(val);
+    }
+    std::size_t size() const { return list.size(); }
+private:
+    std::list<T> list;
+    std::multiset<T> set;
+};
+
+struct Options {
+    std::size_t maxSize = 10000000;
+    double budget = 2.0;// Seconds a single measurement may be predicted to take
+    std::size_t maxBytes = std::size_t(1) << 30;// Memory a measurement may be estimated to need
+    std::string filter;// Only series whose "container/op/payload/input" contains this
+    std::string out;// JSON file, stdout when empty
+};
+
+struct Result {
+    std::string container, op, payload, input;
+    std::size_t size;// Elements in the container
+    std::size_t ops;// Operations timed per repetition
+    std::size_t reps;// Repetitions averaged
+    double nsPerOp;
+};
+
+constexpr double minSeconds = 0.05;// Small cases repeat until they ran this long
+constexpr std::size_t probeCount = 1000;// Operations timed for the per-element operations
+
+// Time an operation: setup() builds the state untimed, run() does the timed work and returns
+// the operations it did. Repeats until minSeconds of timed work; also reports the wall time.
+template<typename Setup, typename Run>
+static std::pair<double, std::size_t> measure(Setup &&setup, Run &&run, std::size_t &ops, double &wall) {
+    auto begin = Clock::now();
+    double timed = 0;
+    std::size_t reps = 0;
+    do {
+        setup();
+        auto start = Clock::now();
+        ops = run();
+        timed += std::chrono::duration<double>(Clock::now() - start).count();
+        ++reps;
+    } while(timed < minSeconds);
+    wall = std::chrono::duration<double>(Clock::now() - begin).count();
+    return {timed * 1e9 / static_cast<double>(reps * std::max<std::size_t>(ops, 1)), reps};
+}
+
+// Every operation of one container, payload and input, across the sizes
+template<typename Adapter, typename T>
+static void runContainer(const Options &options, Input input, std::vector<Result> &results) {
+    struct Op {
+        const char* name;
+        bool destructive;// Whether every repetition needs a fresh container
+        std::function<std::size_t(Adapter&, std::optional<Adapter>&, const std::vector<T>&, const std::vector<std::size_t>&)> run;
+    };
+    const std::vector<Op> ops = {
+        {"push_back", true, [](Adapter& a, auto&, const auto& vals, const auto&) {
+            for(const T& val : vals) a.push_back(val);
+            return vals.size();
+        }},
+        {"push_front", true, [](Adapter& a, auto&, const auto& vals, const auto&) {
+            for(const T& val : vals) a.push_front(val);
+            return vals.size();
+        }},
+        {"insertAt", true, [](Adapter& a, auto&, const auto& vals, const auto& probes) {
+            for(std::size_t p : probes) a.insertAt(vals[p], p % (a.size() + 1));
+            return probes.size();
+        }},
+        {"getNodeAt", false, [](Adapter& a, auto&, const auto&, const auto& probes) {
+            for(std::size_t p : probes) consume(a.at(p));
+            return probes.size();
+        }},
+        {"erase", true, [](Adapter& a, auto&, const auto&, const auto& probes) {
+            std::size_t done = 0;
+            for(std::size_t p : probes) {
+                if(a.size() == 0) break;
+                a.erase(p % a.size());
+                ++done;
+            }
+            return done;
+        }},
+        {"remove", true, [](Adapter& a, auto&, const auto& vals, const auto& probes) {
+            for(std::size_t p : probes) a.remove(vals[p]);
+            return probes.size();
+        }},
+        {"unique", true, [](Adapter& a, auto&, const auto& vals, const auto&) {
+            a.unique();
+            return vals.size();
+        }},
+        {"merge", true, [](Adapter& a, std::optional<Adapter>& other, const auto& vals, const auto&) {
+            a.merge(*other);
+            return vals.size();
+        }},
+        {"splice", true, [](Adapter& a, std::optional<Adapter>& other, const auto&, const auto&) {
+            std::size_t count = other->size();
+            a.splice(a.size() / 2, *other);
+            return count;
+        }},
+        {"copy", false, [](Adapter& a, std::optional<Adapter>& other, const auto& vals, const auto&) {
+            other.emplace(a);
+            return vals.size();
+        }},
+        {"sort", true, [](Adapter& a, auto&, const auto& vals, const auto&) {
+            a.sort();
+            return vals.size();
+        }},
+        {"sorted_iteration", false, [](Adapter& a, auto&, const auto& vals, const auto&) {
+            a.sorted([](const T& val) { consume(val); });
+            return vals.size();
+        }},
+    };
+
+    for(const Op& op : ops) {
+        std::string series = std::string(Adapter::name) + "/" + op.name + "/" + payloadName<T>() + "/" + inputName(input);
+        if(!options.filter.empty() && series.find(options.filter) == std::string::npos) continue;
+        if(std::string(op.name) == "erase" && !Adapter::positional_erase) continue;
+
+        double lastWall = 0;
+        double growth = 10;
+        for(std::size_t n = 10; n <= options.maxSize; n *= 10) {
+            if(n > 10 && lastWall * growth > options.budget) break;
+            if(n * (sizeof(T) + 64) * 4 > options.maxBytes) break;
+
+            std::vector<T> vals;
+            vals.reserve(n);
+            for(std::uint64_t key : keys(input, n, n)) vals.push_back(payload<T>(key));
+            std::vector<std::size_t> probes;
+            std::mt19937_64 rng(n + 1);
+            for(std::size_t i = 0; i < std::min(n, probeCount); ++i) probes.push_back(rng() % n);
+
+            bool building = std::string(op.name) != "push_back" && std::string(op.name) != "push_front";
+            std::string name(op.name);
+            std::optional<Adapter> state;
+            std::optional<Adapter> other;
+            auto build = [&](std::optional<Adapter>& target, std::size_t count) {
+                target.emplace();
+                for(std::size_t i = 0; i < count; ++i) target->push_back(vals[i]);
+            };
+            auto setup = [&] {
+                if(state && !op.destructive) {
+                    if(name == "copy") other.reset();
+                    return;
+                }
+                state.reset();
+                other.reset();
+                if(building) build(state, n); else state.emplace();
+                if(name == "merge") build(other, n);
+                if(name == "splice") build(other, std::min(n, probeCount));
+            };
+            std::size_t count = 0;
+            double wall = 0;
+            auto [ns, reps] = measure(setup, [&] { return op.run(*state, other, vals, probes); }, count, wall);
+            results.push_back(Result{Adapter::name, op.name, payloadName<T>(), inputName(input), n, count, reps, ns});
+            std::fprintf(stderr, "%-60s %9zu %12.1f ns/op\n", series.c_str(), n, ns);
+
+            if(lastWall > 0) growth = std::max(10.0, wall / lastWall);
+            lastWall = wall;
+        }
+    }
+}
+
+template<typename T>
+static void runPayload(const Options &options, std::vector<Result> &results) {
+    for(Input input : {Input::random, Input::sorted, Input::reversed, Input::duplicates}) {
+        runContainer<FrankensteinAdapter<T>, T>(options, input, results);
+        runContainer<ListAdapter<T>, T>(options, input, results);
+        runContainer<MultisetAdapter<T>, T>(options, input, results);
+        runContainer<PairAdapter<T>, T>(options, input, results);
+    }
+}
+
+static void writeJson(std::ostream &os, const std::vector<Result> &results) {
+    os << "{\n  \"benchmark\": \"frankenstein_bench\",\n  \"unit\": \"ns_per_op\",\n  \"results\": [";
+    for(std::size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        os << (i ? ",\n" : "\n") << "    {\"container\": \"" << r.container << "\", \"op\": \"" << r.op
+           << "\", \"payload\": \"" << r.payload << "\", \"input\": \"" << r.input << "\", \"size\": " << r.size
+           << ", \"ops\": " << r.ops << ", \"reps\": " << r.reps << ", \"ns_per_op\": " << r.nsPerOp << "}";
+    }
+    os << "\n  ]\n}\n";
+}
+
+int main(int argc, char *argv[]) {
+    Options options;
+    for(int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        if(!value) {
+            std::fprintf(stderr, "Missing value for %s\n", arg.c_str());
+            return 1;
+        }
+        if(arg == "--max-size") options.maxSize = std::strtoull(value, nullptr, 10);
+        else if(arg == "--budget") options.budget = std::strtod(value, nullptr);
+        else if(arg == "--max-bytes") options.maxBytes = std::strtoull(value, nullptr, 10);
+        else if(arg == "--filter") options.filter = value;
+        else if(arg == "--out") options.out = value;
+        else {
+            std::fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return 1;
+        }
+        ++i;
+    }
+
+    std::vector<Result> results;
+    runPayload<int>(options, results);
+    runPayload<std::string>(options, results);
+    runPayload<Record>(options, results);
+
+    if(options.out.empty()) {
+        writeJson(std::cout, results);
+    } else {
+        std::ofstream file(options.out);
+        writeJson(file, results);
+    }
+    return 0;
+}
@@ -0,0 +1,71 @@
+// Text loading throughput: from_file() against reading with >> and push_back().
+// Usage: frankenstein_load_bench [input megabytes] [scratch file]
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <string>
+#include "../FrankensteinList.h"
+
+using List = FrankensteinList<long long>;
+using Clock = std::chrono::steady_clock;
+
+// Write whitespace-separated numbers until the file holds the given number of bytes.
+// Ascending values keep push_back() on its constant-time path, random ones make the
+// final sort of from_file() do real work.
+static void writeInput(const std::string &path, std::size_t bytes, bool ascending) {
+    std::mt19937_64 rng(42);
+    std::ofstream os(path, std::ios::binary | std::ios::trunc);
+    std::string line;
+    long long value = 0;
+    std::size_t written = 0;
+    while(written < bytes) {
+        line.clear();
+        for(int i = 0; i < 16; ++i) {
+            value = ascending ? value + static_cast<long long>(rng() % 1000) : static_cast<long long>(rng() % 4000000000000ULL);
+            line += std::to_string(value);
+            line += (i == 15) ? '\n' : ' ';
+        }
+        os << line;
+        written += line.size();
+    }
+}
+
+static double megabytesPerSecond(const std::string &path, Clock::duration took) {
+    std::ifstream is(path, std::ios::binary | std::ios::ate);
+    double megabytes = static_cast<double>(is.tellg()) / (1 << 20);
+    return megabytes / std::chrono::duration<double>(took).count();
+}
+
+int main(int argc, char *argv[]) {
+    std::size_t megabytes = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 256;
+    std::string path = (argc > 2) ? argv[2] : "frankenstein_load_bench.txt";
+    std::printf("input: %zu MB\n", megabytes);
+
+    for(bool ascending : {true, false}) {
+        writeInput(path, megabytes << 20, ascending);
+
+        auto start = Clock::now();
+        List loaded = List::from_file(path);
+        Clock::duration took = Clock::now() - start;
+        std::printf("%-10s from_file          %8.1f MB/s  (%d values)\n", ascending ? "ascending" : "random",
+                    megabytesPerSecond(path, took), loaded.getSize());
+
+        // Random values would make every push_back() walk the sorted chain
+        if(ascending) {
+            start = Clock::now();
+            List pushed;
+            std::ifstream is(path);
+            long long value;
+            while(is >> value) {
+                pushed.push_back(value);
+            }
+            took = Clock::now() - start;
+            std::printf("%-10s >> and push_back   %8.1f MB/s  (%d values)\n", "ascending",
+                        megabytesPerSecond(path, took), pushed.getSize());
+        }
+    }
+    std::remove(path.c_str());
+    return 0;
+}
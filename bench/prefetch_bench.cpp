@@ -0,0 +1,98 @@
+// Out-of-cache walks with and without jump hints.
+// Usage: frankenstein_prefetch_bench [node count]
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <initializer_list>
+#include <random>
+#include <vector>
+#include "../FrankensteinList.h"
+
+using Clock = std::chrono::steady_clock;
+
+// Churn the heap so that consecutive nodes land at unrelated addresses: free
+// node-sized blocks in random order, the allocator hands them back in that order.
+// Every size is churned in one go, growing the heap afterwards would let the
+// allocator coalesce the freed blocks again.
+static void scatterHeap(std::size_t count, std::initializer_list<std::size_t> sizes, std::mt19937 &rng) {
+    std::vector<void*> holes;
+    holes.reserve(count * sizes.size());
+    for(std::size_t i = 0; i < count; ++i) {
+        for(std::size_t bytes : sizes) {
+            holes.push_back(std::malloc(bytes));
+        }
+    }
+    std::shuffle(holes.begin(), holes.end(), rng);
+    for(void *hole : holes) {
+        std::free(hole);
+    }
+}
+
+// Time one call in nanoseconds per node
+template<typename Fn>
+static double perNode(std::size_t count, Fn &&fn) {
+    auto start = Clock::now();
+    fn();
+    std::chrono::duration<double, std::nano> took = Clock::now() - start;
+    return took.count() / count;
+}
+
+template<typename Policy>
+static void build(FrankensteinList<int, Policy> &list, std::size_t count) {
+    for(std::size_t i = 0; i < count; ++i) {
+        list.push_back(static_cast<int>(i));
+    }
+}
+
+// The first walk finds no hints and trains them, the later ones prefetch along them
+template<typename Policy>
+static void measure(const char *name, FrankensteinList<int, Policy> &list) {
+    using List = FrankensteinList<int, Policy>;
+    std::size_t count = list.getSize();
+    long long sum = 0;
+    double first = perNode(count, [&] { sum += list.getNodeAt(count - 1)->val; });
+    double positional = perNode(count, [&] { sum += list.getNodeAt(count - 1)->val; });
+    list.remove(INT_MAX);
+    double sorted = perNode(count, [&] { list.remove(INT_MAX); });
+    double iterated = perNode(count, [&] {
+        for(auto it = list.cbegin(); it != list.cend(); ++it) {
+            sum += *it;
+        }
+    });
+    std::printf("%-24s %2zu B/node  first walk %7.2f  getNodeAt %7.2f  remove %7.2f  iterator %7.2f ns/node  (%lld)\n",
+                name, sizeof(typename List::NodeType), first, positional, sorted, iterated, sum);
+}
+
+struct IndexPrefetchPolicy : IndexListPolicy {
+    using Hints = JumpHints<8>;
+};
+
+int main(int argc, char *argv[]) {
+    std::size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    std::mt19937 rng(42);
+    std::printf("nodes: %zu\n", count);
+
+    // Pointer lists on a churned heap, both built before either is freed so neither sees recycled memory
+    {
+        FrankensteinList<int> plain;
+        FrankensteinList<int, PrefetchListPolicy> hinted;
+        scatterHeap(count, {sizeof(decltype(plain)::NodeType), sizeof(decltype(hinted)::NodeType)}, rng);
+        build(plain, count);
+        build(hinted, count);
+        measure("DefaultListPolicy", plain);
+        measure("PrefetchListPolicy", hinted);
+    }
+
+    // Index lists fill their arena in order, the hints only add their upkeep here
+    {
+        FrankensteinList<int, IndexListPolicy> plain;
+        FrankensteinList<int, IndexPrefetchPolicy> hinted;
+        build(plain, count);
+        build(hinted, count);
+        measure("IndexListPolicy", plain);
+        measure("IndexLinks, JumpHints<8>", hinted);
+    }
+    return 0;
+}
@@ -0,0 +1,132 @@
+// Replays an operation trace recorded with RecordingFrankensteinList against this build:
+// end-to-end throughput over the whole trace, then the latency of every call by operation.
+// Usage: frankenstein_replay <trace> [--policy default|index|prefetch|fingerprint|small|all] [--repeat N]
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../RecordingFrankensteinList.h"
+
+using Clock = std::chrono::steady_clock;
+namespace trace = frankenstein_trace;
+namespace timing = frankenstein_timing;
+
+struct Options {
+    std::string policy = "all";
+    int repeat = 3;
+};
+
+// Replay the trace with one policy. The records are decoded and the starting list copied
+// before the clock starts, so only the calls themselves are measured.
+template<typename T, typename Policy>
+static void replay(const char *policyName, const std::string &bytes, const Options &options) {
+    using Recorder = RecordingFrankensteinList<T, Policy>;
+    using List = typename Recorder::List;
+
+    std::istringstream is(bytes);
+    List start;
+    std::vector<typename Recorder::Record> records = Recorder::readTrace(is, start);
+    std::size_t sink = 0;
+
+    double best = 1e30;
+    for(int pass = 0; pass < options.repeat; ++pass) {
+        List list(start);
+        auto begin = Clock::now();
+        for(const auto& r : records) {
+            sink += Recorder::apply(list, r);
+        }
+        best = std::min(best, std::chrono::duration<double>(Clock::now() - begin).count());
+    }
+    std::printf("%-12s %10zu calls %12.3f ms %10.3f Mcalls/s\n", policyName, records.size(), best * 1e3,
+                static_cast<double>(records.size()) / best * 1e-6);
+
+    // Latency pass: each call timed on its own, which adds the cost of two clock reads
+    std::vector<timing::Histogram> latency(static_cast<std::size_t>(trace::Op::end));
+    List list(start);
+    for(const auto& r : records) {
+        auto begin = Clock::now();
+        sink += Recorder::apply(list, r);
+        auto ns = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin).count());
+        timing::Histogram &h = latency[static_cast<std::size_t>(r.op)];
+        ++h.counts[timing::bucketOf(ns)];
+        ++h.total;
+        h.sum += ns;
+    }
+    for(std::size_t op = 1; op < latency.size(); ++op) {
+        const timing::Histogram &h = latency[op];
+        if(h.total == 0) continue;
+        std::printf("  %-14s %10llu calls  mean %10.0f ns  p50 %10llu ns  p99 %10llu ns  max %10llu ns\n",
+                    trace::name(static_cast<trace::Op>(op)), static_cast<unsigned long long>(h.total),
+                    static_cast<double>(h.sum) / static_cast<double>(h.total), static_cast<unsigned long long>(h.quantile(0.5)),
+                    static_cast<unsigned long long>(h.quantile(0.99)), static_cast<unsigned long long>(h.quantile(1.0)));
+    }
+    if(sink == 1) std::printf("\n");// Keeps the query results alive
+}
+
+// Replay with the chosen policies
+template<typename T>
+static void replayPolicies(const std::string &bytes, const Options &options) {
+    bool all = (options.policy == "all");
+    bool any = false;
+    auto run = [&](const char *name, auto policy) {
+        if(!all && options.policy != name) return;
+        any = true;
+        replay<T, decltype(policy)>(name, bytes, options);
+    };
+    run("default", DefaultListPolicy());
+    run("index", IndexListPolicy());
+    run("prefetch", PrefetchListPolicy());
+    run("fingerprint", FingerprintListPolicy());
+    run("small", SmallListPolicy<16>());
+    if(!any) {
+        throw std::runtime_error("Unknown policy: " + options.policy);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    // Every option takes a value, so the arguments after the trace come in pairs
+    if(argc < 2 || (argc - 2) % 2 != 0) {
+        std::fprintf(stderr, "usage: %s <trace> [--policy default|index|prefetch|fingerprint|small|all] [--repeat N]\n", argv[0]);
+        return 2;
+    }
+    Options options;
+    for(int i = 2; i < argc; i += 2) {
+        if(std::strcmp(argv[i], "--policy") == 0) options.policy = argv[i + 1];
+        else if(std::strcmp(argv[i], "--repeat") == 0) options.repeat = std::max(1, std::atoi(argv[i + 1]));
+        else {
+            std::fprintf(stderr, "unknown option %s\n", argv[i]);
+            return 2;
+        }
+    }
+
+    try {
+        std::ifstream file(argv[1], std::ios::binary);
+        if(!file) {
+            throw std::runtime_error(std::string("Failed to open list trace: ") + argv[1]);
+        }
+        std::ostringstream contents;
+        contents << file.rdbuf();
+        std::string bytes = contents.str();
+
+        std::istringstream is(bytes);
+        trace::Header header = trace::readHeader(is);
+        auto kind = static_cast<trace::ValueKind>(header.valueKind);
+        if(kind == trace::ValueKind::signedInteger && header.valueBytes == 4) replayPolicies<std::int32_t>(bytes, options);
+        else if(kind == trace::ValueKind::signedInteger && header.valueBytes == 8) replayPolicies<std::int64_t>(bytes, options);
+        else if(kind == trace::ValueKind::unsignedInteger && header.valueBytes == 4) replayPolicies<std::uint32_t>(bytes, options);
+        else if(kind == trace::ValueKind::unsignedInteger && header.valueBytes == 8) replayPolicies<std::uint64_t>(bytes, options);
+        else if(kind == trace::ValueKind::floatingPoint && header.valueBytes == 8) replayPolicies<double>(bytes, options);
+        else if(kind == trace::ValueKind::string && header.valueBytes == sizeof(std::string)) replayPolicies<std::string>(bytes, options);
+        else throw std::runtime_error("List trace holds values this tool cannot replay.");
+    } catch(const std::exception &e) {
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+// Traversal throughput of FrankensteinList before and after compaction.
+// Usage: frankenstein_traversal_bench [node count]
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "../FrankensteinList.h"
+
+using List = FrankensteinList<int>;
+using Clock = std::chrono::steady_clock;
+
+// Sum the list in the given order, best of a few passes, in nanoseconds per node
+static double walk(const List &list, List::IteratorType order, long long &sink) {
+    double best = 1e30;
+    for(int pass = 0; pass < 5; ++pass) {
+        auto start = Clock::now();
+        long long sum = 0;
+        for(List::ConstIterator it = list.cbegin(order); it != list.cend(); ++it) {
+            sum += *it;
+        }
+        std::chrono::duration<double, std::nano> took = Clock::now() - start;
+        best = std::min(best, took.count() / list.getSize());
+        sink += sum;
+    }
+    return best;
+}
+
+// Churn the heap so that consecutive nodes land at unrelated addresses:
+// free node-sized blocks in random order, the allocator hands them back in that order
+static void scatterHeap(std::size_t count, std::mt19937 &rng) {
+    std::vector<void*> holes(count);
+    for(void *&hole : holes) {
+        hole = std::malloc(sizeof(List::NodeType));
+    }
+    std::shuffle(holes.begin(), holes.end(), rng);
+    for(void *hole : holes) {
+        std::free(hole);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    std::size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 4000000;
+    std::mt19937 rng(42);
+    long long sink = 0;
+
+    // Two lists over the same churned heap, one per compaction mode
+    scatterHeap(2 * count, rng);
+    List list;
+    List scattered;
+    for(std::size_t i = 0; i < count; ++i) {
+        list.push_back(static_cast<int>(i));
+        scattered.push_back(static_cast<int>(i));
+    }
+
+    std::printf("nodes: %zu, node size: %zu bytes\n", count, sizeof(List::NodeType));
+    std::printf("%-34s %8.2f ns/node\n", "scattered, insertion order", walk(list, List::IteratorType::head, sink));
+    std::printf("%-34s %8.2f ns/node\n", "scattered, ascending order", walk(list, List::IteratorType::asc_head, sink));
+
+    auto start = Clock::now();
+    list.compact(List::IteratorType::head);
+    std::chrono::duration<double, std::milli> took = Clock::now() - start;
+    std::printf("%-34s %8.2f ms\n", "compact(head)", took.count());
+    std::printf("%-34s %8.2f ns/node\n", "compacted, insertion order", walk(list, List::IteratorType::head, sink));
+
+    // Compact incrementally, in bounded steps that leave the list usable in between
+    std::printf("%-34s %8.2f ns/node\n", "scattered, ascending order", walk(scattered, List::IteratorType::asc_head, sink));
+    std::size_t steps = 1;
+    start = Clock::now();
+    while(!scattered.compactStep(List::IteratorType::asc_head, 4096)) {
+        ++steps;
+    }
+    took = Clock::now() - start;
+    std::printf("%-34s %8.2f ms in %zu steps\n", "compactStep(asc_head, 4096)", took.count(), steps);
+    std::printf("%-34s %8.2f ns/node\n", "compacted, ascending order", walk(scattered, List::IteratorType::asc_head, sink));
+
+    std::printf("checksum: %lld\n", sink);
+    return 0;
+}